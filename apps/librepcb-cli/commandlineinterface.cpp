@@ -49,6 +49,7 @@
 #include <librepcb/core/project/project.h>
 #include <librepcb/core/project/projectmetadata.h>
 #include <librepcb/core/project/schematic/schematicpainter.h>
+#include <librepcb/core/tracer.h>
 
 #include <QtCore>
 
@@ -93,6 +94,12 @@ int CommandLineInterface::execute() noexcept {
   const QCommandLineOption versionOption = parser.addVersionOption();
   QCommandLineOption verboseOption("verbose", tr("Verbose output."));
   parser.addOption(verboseOption);
+  QCommandLineOption traceOption(
+      "trace",
+      tr("Record timing information of the executed operations and write it "
+         "to the given file in the Chrome trace event format."),
+      tr("file"));
+  parser.addOption(traceOption);
   parser.addPositionalArgument("command",
                                tr("The command to execute (see list below)."));
   positionalArgNames.append("command");
@@ -268,6 +275,13 @@ int CommandLineInterface::execute() noexcept {
     Debug::instance()->setDebugLevelStderr(Debug::DebugLevel_t::All);
   }
 
+  // --trace
+  if (parser.isSet(traceOption)) {
+    Tracer::instance().setOutputFilePath(
+        FilePath(QFileInfo(parser.value(traceOption)).absoluteFilePath()));
+    Tracer::instance().setEnabled(true);
+  }
+
   // --help (also shown if no arguments supplied)
   if (parser.isSet(helpOption) || (args.count() <= 1)) {
     print(helpText);
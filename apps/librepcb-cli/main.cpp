@@ -24,6 +24,7 @@
 
 #include <librepcb/core/application.h>
 #include <librepcb/core/debug.h>
+#include <librepcb/core/tracer.h>
 
 #include <QtCore>
 
@@ -62,5 +63,10 @@ int main(int argc, char* argv[]) {
 
   // Run application
   cli::CommandLineInterface cli(app);
-  return cli.execute();
+  const int retval = cli.execute();
+
+  // Write the trace file, if tracing was enabled with "--trace" or by the
+  // environment variable "LIBREPCB_TRACE_FILE".
+  Tracer::instance().finish();
+  return retval;
 }
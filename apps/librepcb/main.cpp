@@ -24,6 +24,7 @@
 #include <librepcb/core/debug.h>
 #include <librepcb/core/exceptions.h>
 #include <librepcb/core/network/networkaccessmanager.h>
+#include <librepcb/core/tracer.h>
 #include <librepcb/core/workspace/workspace.h>
 #include <librepcb/core/workspace/workspacesettings.h>
 #include <librepcb/editor/dialogs/directorylockhandlerdialog.h>
@@ -91,6 +92,10 @@ int main(int argc, char* argv[]) {
   // Stop network access manager thread
   networkAccessManager.reset();
 
+  // Write the trace file if tracing was enabled by the environment variable
+  // "LIBREPCB_TRACE_FILE".
+  Tracer::instance().finish();
+
   qDebug().nospace() << "Exit application with code " << retval << ".";
   return retval;
 }
@@ -0,0 +1,21 @@
+# Try to find the Google Benchmark library on the system
+find_package(benchmark CONFIG)
+if(benchmark_FOUND)
+  message(STATUS "Using system Google Benchmark")
+
+  # Stop here, we're done
+  return()
+endif()
+
+# Otherwise, try to find shared library on the system via pkg-config
+find_package(PkgConfig QUIET)
+if(PKGCONFIG_FOUND)
+  pkg_check_modules(benchmark GLOBAL IMPORTED_TARGET benchmark)
+endif()
+if(benchmark_FOUND)
+  message(STATUS "Using system Google Benchmark (via pkg-config)")
+  add_library(benchmark::benchmark ALIAS PkgConfig::benchmark)
+  return()
+endif()
+
+message(FATAL_ERROR "Did not find Google Benchmark system library")
@@ -0,0 +1,277 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "copperconnectivitybuilder.h"
+
+#include "../utils/clipperhelpers.h"
+
+#include <QtCore>
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <map>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+CopperConnectivityBuilder::CopperConnectivityBuilder() noexcept
+  : mItems(),
+    mParents(),
+    mRanks(),
+    mItemClusters(),
+    mOverlaps(),
+    mShortCircuits(),
+    mClusterCount(0) {
+}
+
+CopperConnectivityBuilder::~CopperConnectivityBuilder() noexcept {
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+int CopperConnectivityBuilder::addItem(const QString& layerName,
+                                       const ClipperLib::Paths& paths,
+                                       int net) noexcept {
+  Item item{layerName, paths, ClipperLib::IntRect{0, 0, 0, 0}, true, net};
+  item.boundingBox.left = std::numeric_limits<ClipperLib::cInt>::max();
+  item.boundingBox.top = std::numeric_limits<ClipperLib::cInt>::max();
+  item.boundingBox.right = std::numeric_limits<ClipperLib::cInt>::min();
+  item.boundingBox.bottom = std::numeric_limits<ClipperLib::cInt>::min();
+  for (const ClipperLib::Path& path : paths) {
+    for (const ClipperLib::IntPoint& p : path) {
+      item.boundingBox.left = std::min(item.boundingBox.left, p.X);
+      item.boundingBox.top = std::min(item.boundingBox.top, p.Y);
+      item.boundingBox.right = std::max(item.boundingBox.right, p.X);
+      item.boundingBox.bottom = std::max(item.boundingBox.bottom, p.Y);
+      item.isEmpty = false;
+    }
+  }
+  mItems.append(item);
+  return mItems.count() - 1;
+}
+
+void CopperConnectivityBuilder::build() {
+  // Initialize the union-find structure with one set per item.
+  mParents.resize(mItems.count());
+  mRanks.fill(0, mItems.count());
+  for (int i = 0; i < mItems.count(); ++i) {
+    mParents[i] = i;
+  }
+  mOverlaps.clear();
+
+  // Determine all layers. Items on all layers must be checked on every layer,
+  // or on a single pass if there are no items on specific layers at all.
+  QSet<QString> layers;
+  foreach (const Item& item, mItems) {
+    if (!item.layerName.isEmpty()) {
+      layers.insert(item.layerName);
+    }
+  }
+  if (layers.isEmpty()) {
+    layers.insert(QString());
+  }
+
+  bool firstLayer = true;
+  foreach (const QString& layer, layers) {
+    // Get all items on this layer, sorted by the left edge of their bounding
+    // box.
+    QVector<int> items;
+    for (int i = 0; i < mItems.count(); ++i) {
+      const Item& item = mItems.at(i);
+      if ((!item.isEmpty) &&
+          (item.layerName.isEmpty() || (item.layerName == layer))) {
+        items.append(i);
+      }
+    }
+    std::sort(items.begin(), items.end(), [this](int a, int b) {
+      return mItems.at(a).boundingBox.left < mItems.at(b).boundingBox.left;
+    });
+
+    // Sweep from left to right, keeping the items whose bounding box
+    // intersects the sweep line in the active map. The map is ordered by the
+    // right edge of the bounding boxes, so expired items are always at the
+    // beginning and can be removed without scanning all active items.
+    std::multimap<ClipperLib::cInt, int> active;
+    foreach (int i, items) {
+      const ClipperLib::IntRect& box = mItems.at(i).boundingBox;
+      while ((!active.empty()) && (active.begin()->first < box.left)) {
+        active.erase(active.begin());
+      }
+      for (const auto& pair : active) {
+        const int k = pair.second;
+        const Item& item1 = mItems.at(k);
+        const Item& item2 = mItems.at(i);
+        const ClipperLib::IntRect& other = item1.boundingBox;
+        if ((other.bottom < box.top) || (other.top > box.bottom)) {
+          continue;
+        }
+        // Items on all layers are compared only in the first pass.
+        if ((!firstLayer) && item1.layerName.isEmpty() &&
+            item2.layerName.isEmpty()) {
+          continue;
+        }
+        const bool sameNet = (item1.net >= 0) && (item1.net == item2.net);
+        if (sameNet && (findRoot(i) == findRoot(k))) {
+          continue;
+        }
+        if (overlap(i, k)) {  // can throw
+          unite(i, k);
+          if (!sameNet) {
+            mOverlaps.append(std::make_pair(k, i));
+          }
+        }
+      }
+      active.emplace(box.right, i);
+    }
+    firstLayer = false;
+  }
+
+  // Assign consecutive cluster indices.
+  QHash<int, int> rootClusters;
+  mItemClusters.resize(mItems.count());
+  for (int i = 0; i < mItems.count(); ++i) {
+    const int root = findRoot(i);
+    auto it = rootClusters.find(root);
+    if (it == rootClusters.end()) {
+      it = rootClusters.insert(root, rootClusters.count());
+    }
+    mItemClusters[i] = it.value();
+  }
+  mClusterCount = rootClusters.count();
+
+  buildShortCircuits();
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+int CopperConnectivityBuilder::findRoot(int item) noexcept {
+  int root = item;
+  while (mParents.at(root) != root) {
+    root = mParents.at(root);
+  }
+  while (mParents.at(item) != root) {  // Path compression.
+    const int parent = mParents.at(item);
+    mParents[item] = root;
+    item = parent;
+  }
+  return root;
+}
+
+void CopperConnectivityBuilder::unite(int item1, int item2) noexcept {
+  const int root1 = findRoot(item1);
+  const int root2 = findRoot(item2);
+  if (root1 == root2) {
+    return;
+  }
+  if (mRanks.at(root1) < mRanks.at(root2)) {
+    mParents[root1] = root2;
+  } else if (mRanks.at(root1) > mRanks.at(root2)) {
+    mParents[root2] = root1;
+  } else {
+    mParents[root2] = root1;
+    ++mRanks[root1];
+  }
+}
+
+bool CopperConnectivityBuilder::overlap(int item1, int item2) const {
+  std::unique_ptr<ClipperLib::PolyTree> intersections =
+      ClipperHelpers::intersect(mItems.at(item1).paths,
+                                mItems.at(item2).paths);  // can throw
+  return !ClipperHelpers::flattenTree(*intersections).empty();
+}
+
+void CopperConnectivityBuilder::buildShortCircuits() noexcept {
+  mShortCircuits.clear();
+
+  // Direct overlaps between items of different nets.
+  foreach (const auto& overlap, mOverlaps) {
+    const int net1 = mItems.at(overlap.first).net;
+    const int net2 = mItems.at(overlap.second).net;
+    if ((net1 >= 0) && (net2 >= 0)) {
+      mShortCircuits.append(ShortCircuit{std::min(net1, net2),
+                                         std::max(net1, net2), {overlap}});
+    }
+  }
+
+  // Unconnected items short all nets they are touching, either directly or
+  // through other unconnected items. Group them with a separate union-find
+  // structure which only follows overlaps between unconnected items.
+  QHash<int, int> parents;
+  auto findParent = [&parents](int item) {
+    while (parents.value(item, item) != item) {
+      item = parents.value(item, item);
+    }
+    return item;
+  };
+  foreach (const auto& overlap, mOverlaps) {
+    if ((mItems.at(overlap.first).net < 0) &&
+        (mItems.at(overlap.second).net < 0)) {
+      const int root1 = findParent(overlap.first);
+      const int root2 = findParent(overlap.second);
+      if (root1 != root2) {
+        parents.insert(root2, root1);
+      }
+    }
+  }
+  QMap<int, QMap<int, QVector<std::pair<int, int>>>> groupNetOverlaps;
+  foreach (const auto& overlap, mOverlaps) {
+    const int net1 = mItems.at(overlap.first).net;
+    const int net2 = mItems.at(overlap.second).net;
+    if ((net1 < 0) && (net2 >= 0)) {
+      groupNetOverlaps[findParent(overlap.first)][net2].append(overlap);
+    } else if ((net1 >= 0) && (net2 < 0)) {
+      groupNetOverlaps[findParent(overlap.second)][net1].append(overlap);
+    }
+  }
+  foreach (const auto& netOverlaps, groupNetOverlaps) {
+    // Report the shorted nets pairwise in ascending order, i.e. N nets
+    // touching the same unconnected copper lead to N-1 short circuits.
+    auto it = netOverlaps.begin();
+    for (auto next = std::next(it); next != netOverlaps.end(); it = next++) {
+      mShortCircuits.append(ShortCircuit{it.key(), next.key(),
+                                         it.value() + next.value()});
+    }
+  }
+
+  std::stable_sort(mShortCircuits.begin(), mShortCircuits.end(),
+                   [](const ShortCircuit& a, const ShortCircuit& b) {
+                     return std::make_pair(a.net1, a.net2) <
+                         std::make_pair(b.net1, b.net2);
+                   });
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
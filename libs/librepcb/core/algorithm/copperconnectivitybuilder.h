@@ -0,0 +1,180 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_CORE_COPPERCONNECTIVITYBUILDER_H
+#define LIBREPCB_CORE_COPPERCONNECTIVITYBUILDER_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <polyclipping/clipper.hpp>
+
+#include <QtCore>
+
+#include <utility>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Class CopperConnectivityBuilder
+ ******************************************************************************/
+
+/**
+ * @brief Determines which copper items are electrically connected by overlap
+ *
+ * Each added item consists of an area on a single copper layer, or on all
+ * copper layers (e.g. vias and THT pads, which thereby connect the layers).
+ * #build() groups all items into clusters of physically connected copper:
+ *
+ *   1. For every layer, the bounding boxes of the items are swept from left
+ *      to right (sorted by their left edge), so only items with overlapping
+ *      bounding boxes are compared against each other.
+ *   2. Items of the same net which are already in the same cluster are
+ *      skipped, all others are checked for a real overlap of their areas.
+ *   3. Overlapping items are merged with a union-find (disjoint-set)
+ *      structure with path compression and union by rank.
+ *
+ * For typical boards this runs in near-linear time in the number of items.
+ *
+ * In addition, every overlap between items of different nets is reported as
+ * a short circuit (see #getShortCircuits()). Unconnected items (e.g.
+ * polygons without net) don't belong to any net, but they short all nets
+ * they are touching.
+ */
+class CopperConnectivityBuilder final {
+public:
+  // Types
+  struct ShortCircuit {
+    int net1;  ///< Lower net ID
+    int net2;  ///< Higher net ID
+    /// Pairs of overlapping items which make up the short circuit. For a
+    /// direct short, this is the single pair of items of both nets. For a
+    /// short through unconnected copper, these are the overlaps between the
+    /// unconnected items and the items of both nets.
+    QVector<std::pair<int, int>> overlaps;
+  };
+
+  // Constructors / Destructor
+  CopperConnectivityBuilder() noexcept;
+  CopperConnectivityBuilder(const CopperConnectivityBuilder& other) = delete;
+  ~CopperConnectivityBuilder() noexcept;
+
+  // Getters
+  int getItemCount() const noexcept { return mItems.count(); }
+
+  /**
+   * @brief Get the number of clusters found by #build()
+   *
+   * @return Number of clusters (0 if #build() was not called yet)
+   */
+  int getClusterCount() const noexcept { return mClusterCount; }
+
+  /**
+   * @brief Get the cluster an item belongs to
+   *
+   * @param item  ID of the item, as returned by #addItem().
+   *
+   * @return Cluster index in the range [0..#getClusterCount()-1]. Items with
+   *         the same cluster index are connected by copper.
+   */
+  int getClusterOfItem(int item) const noexcept {
+    return mItemClusters.value(item, -1);
+  }
+
+  /**
+   * @brief Get the copper area of an item
+   *
+   * @param item  ID of the item, as returned by #addItem().
+   *
+   * @return The paths passed to #addItem()
+   */
+  const ClipperLib::Paths& getItemPaths(int item) const noexcept {
+    return mItems.at(item).paths;
+  }
+
+  /**
+   * @brief Get the short circuits found by #build()
+   *
+   * @return All overlaps between copper of different nets, sorted by net IDs
+   */
+  const QVector<ShortCircuit>& getShortCircuits() const noexcept {
+    return mShortCircuits;
+  }
+
+  // General Methods
+
+  /**
+   * @brief Add a new copper item
+   *
+   * @param layerName   Name of the copper layer, or an empty string if the
+   *                    item is located on all copper layers.
+   * @param paths       The copper area of the item.
+   * @param net         ID of the net the item belongs to, or -1 if the item
+   *                    is not connected to any net.
+   *
+   * @return The ID of the added item
+   */
+  int addItem(const QString& layerName, const ClipperLib::Paths& paths,
+              int net = -1) noexcept;
+
+  /**
+   * @brief Determine the clusters of connected items
+   *
+   * @throw Exception if a polygon operation failed
+   */
+  void build();
+
+  // Operator Overloadings
+  CopperConnectivityBuilder& operator=(const CopperConnectivityBuilder& rhs) =
+      delete;
+
+private:  // Methods
+  int findRoot(int item) noexcept;
+  void unite(int item1, int item2) noexcept;
+  bool overlap(int item1, int item2) const;
+  void buildShortCircuits() noexcept;
+
+private:  // Data
+  struct Item {
+    QString layerName;  ///< Empty for items on all layers
+    ClipperLib::Paths paths;
+    ClipperLib::IntRect boundingBox;
+    bool isEmpty;
+    int net;  ///< -1 for unconnected items
+  };
+  QVector<Item> mItems;
+  QVector<int> mParents;  ///< Union-find parent item of each item
+  QVector<int> mRanks;  ///< Union-find rank of each item
+  QVector<int> mItemClusters;  ///< Cluster index of each item
+  /// Overlapping item pairs of different nets or with unconnected items
+  QVector<std::pair<int, int>> mOverlaps;
+  QVector<ShortCircuit> mShortCircuits;
+  int mClusterCount;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif
@@ -37,7 +37,11 @@ namespace librepcb {
 
 QString AttributeSubstitutor::substitute(QString str,
                                          const AttributeProvider* ap,
-                                         FilterFunction filter) noexcept {
+                                         FilterFunction filter,
+                                         Dependencies* dependencies) noexcept {
+  if (dependencies) {
+    dependencies->clear();
+  }
   int startPos = 0;
   int length = 0;
   int outerVariableStart = -1;
@@ -62,8 +66,13 @@ QString AttributeSubstitutor::substitute(QString str,
             key.length() - 2;  // do not search for variables in the value
         keyFound = true;
         break;
-      } else if ((getValueOfKey(key, value, ap)) &&
-                 (!keyBacktrace.contains(key))) {
+      }
+      const bool valueFound = getValueOfKey(key, value, ap);
+      if (dependencies) {
+        dependencies->append(
+            Dependency{key, valueFound, valueFound ? value : QString()});
+      }
+      if (valueFound && (!keyBacktrace.contains(key))) {
         // replace "{{KEY}}" with the value of KEY
         str.replace(startPos, length, value);
         keyBacktrace.insert(key);
@@ -82,6 +91,19 @@ QString AttributeSubstitutor::substitute(QString str,
   return str;
 }
 
+bool AttributeSubstitutor::isUpToDate(const Dependencies& dependencies,
+                                      const AttributeProvider* ap) noexcept {
+  foreach (const Dependency& dependency, dependencies) {
+    QString value;
+    const bool found = getValueOfKey(dependency.key, value, ap);
+    if (Dependency{dependency.key, found, found ? value : QString()} !=
+        dependency) {
+      return false;
+    }
+  }
+  return true;
+}
+
 /*******************************************************************************
  *  Private Methods
  ******************************************************************************/
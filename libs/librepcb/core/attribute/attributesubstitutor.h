@@ -60,6 +60,32 @@ class AttributeSubstitutor final {
 public:
   using FilterFunction = std::function<QString(const QString&)>;
 
+  /**
+   * @brief An attribute looked up by #substitute()
+   */
+  struct Dependency {
+    QString key;
+    bool found;  ///< Whether the attribute was defined (and not empty)
+    QString value;  ///< The attribute value (only valid if found)
+
+    bool operator==(const Dependency& rhs) const noexcept {
+      return (key == rhs.key) && (found == rhs.found) && (value == rhs.value);
+    }
+    bool operator!=(const Dependency& rhs) const noexcept {
+      return !(*this == rhs);
+    }
+  };
+
+  /**
+   * @brief Attribute values a substituted string depends on
+   *
+   * Contains all attribute keys looked up by #substitute() together with the
+   * values they resolved to, in lookup order. Since the substituted string
+   * only depends on these values, it does not need to be substituted again as
+   * long as #isUpToDate() returns true.
+   */
+  using Dependencies = QVector<Dependency>;
+
   // Constructors / Destructor / Operator Overloadings
   AttributeSubstitutor() = delete;
   AttributeSubstitutor(const AttributeSubstitutor& other) = delete;
@@ -80,10 +106,32 @@ public:
    *                  to remove invalid characters if the resulting string is
    *                  used for a file path.
    *
+   * @param dependencies  If not nullptr, all looked up attribute keys and
+   *                      their values are written into this list (see
+   *                      #isUpToDate()).
+   *
    * @return True if str was modified in some way, false if not
    */
   static QString substitute(QString str, const AttributeProvider* ap = nullptr,
-                            FilterFunction filter = nullptr) noexcept;
+                            FilterFunction filter = nullptr,
+                            Dependencies* dependencies = nullptr) noexcept;
+
+  /**
+   * @brief Check if the attribute values a substitution depends on are still
+   *        the same
+   *
+   * This only looks up the attributes the string actually references, which
+   * is much cheaper than substituting the whole string again.
+   *
+   * @param dependencies  The dependencies returned by #substitute().
+   * @param ap            The attribute provider passed to #substitute().
+   *
+   * @retval true   All attributes still have the same value, i.e. substituting
+   *                the same string again would lead to the same result.
+   * @retval false  At least one attribute has changed its value.
+   */
+  static bool isUpToDate(const Dependencies& dependencies,
+                         const AttributeProvider* ap) noexcept;
 
 private:  // Methods
   /**
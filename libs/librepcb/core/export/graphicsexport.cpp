@@ -23,6 +23,8 @@
 #include "graphicsexport.h"
 
 #include "../fileio/fileutils.h"
+#include "../tracer.h"
+#include "../utils/scopeguard.h"
 #include "graphicsexportsettings.h"
 
 #include <QtConcurrent>
@@ -47,6 +49,7 @@ GraphicsExport::GraphicsExport(QObject* parent) noexcept
   : QObject(parent),
     mCreator(QString("LibrePCB %1").arg(qApp->applicationVersion())),
     mDocumentName(),
+    mMaxThreadCount(QThread::idealThreadCount()),
     mFuture(),
     mAbort(false) {
   qRegisterMetaType<QImage>();
@@ -125,6 +128,7 @@ QString GraphicsExport::run(RunArgs args) noexcept {
   // Note: This method is called from a different thread, thus be careful with
   //       calling other methods to only call thread-safe methods!
 
+  const TraceZone traceZone("GraphicsExport::run");
   QElapsedTimer timer;
   timer.start();
   qDebug() << "Start graphics export in worker thread...";
@@ -183,51 +187,55 @@ QString GraphicsExport::run(RunArgs args) noexcept {
       throw RuntimeError(__FILE__, __LINE__, tr("No pages to export/print."));
     }
 
-    // Export all pages.
+    // Determine DPI of the output device (0 = depends on page settings).
+    int deviceDpi = 0;
+    if (printer) {
+      deviceDpi = printer->resolution();
+    } else if (pdfWriter) {
+      deviceDpi = pdfWriter->resolution();
+    }
+
+    // Start rendering all pages in parallel, except for paged output devices
+    // which are painted directly in this thread since vector outputs must
+    // not be recorded and replayed (e.g. text sizes would change). Note that
+    // the thread pool must be destroyed before any of the captured objects
+    // since its destructor waits until all started jobs are finished. If
+    // this thread fails, the remaining jobs are aborted by the scope guard.
+    QThreadPool pool;
+    pool.setMaxThreadCount(mMaxThreadCount);
+    auto abortGuard = scopeGuard([this]() { mAbort = true; });
+    QVector<QFuture<PageResult>> futures;
+    if ((!pagedPaintDevice) && (mMaxThreadCount > 1)) {
+      for (int index = 0; index < args.pages.count(); ++index) {
+        futures.append(QtConcurrent::run(&pool, [&, index]() {
+          return renderPage(args, index, deviceDpi, outputFilePathTmpl);
+        }));
+      }
+    }
+
+    // Export all pages in order.
     QPainter painter;
     for (int index = 0; index < args.pages.count(); ++index) {
       const qreal percentPerPage = qreal(80) / args.pages.count();
       emit progress(20 + std::ceil(percentPerPage * index), index + 1,
                     args.pages.count());
-      const Page& page = args.pages.at(index);
-      if (mAbort) {
-        break;
-      }
-
-      // Determine source bounding rect.
-      QRectF sourceRectPx = calcSourceRect(*page.first, *page.second);
-      QTransform sourceTransform = getSourceTransformation(*page.second);
-      QRectF sourceRectTransformedPx = sourceTransform.mapRect(sourceRectPx);
-
-      // Determine output page size.
-      QPageSize pageSize;
-      if (page.second->getPageSize() && page.second->getPageSize()->isValid()) {
-        // Fixed page size is specified.
-        pageSize = *page.second->getPageSize();
-      } else {
-        // Derive page size from source size.
-        Length width = Length::fromPx(sourceRectTransformedPx.width()) +
-            *page.second->getMarginLeft() + *page.second->getMarginRight();
-        Length height = Length::fromPx(sourceRectTransformedPx.height()) +
-            *page.second->getMarginTop() + *page.second->getMarginBottom();
-        pageSize =
-            QPageSize(QSizeF(width.toMm(), height.toMm()),
-                      QPageSize::Millimeter, "Custom", QPageSize::ExactMatch);
-      }
-      if (pagedPaintDevice && (!pagedPaintDevice->setPageSize(pageSize))) {
-        qCritical().nospace()
-            << "Failed to set page size for graphics export to "
-            << pageSize.name() << ".";
-      }
 
-      // Determine output page orientation.
-      const QPageLayout::Orientation pageOrientation =
-          page.second->getOrientation()
-          ? (*page.second->getOrientation())
-          : getOrientation(sourceRectTransformedPx.size());
       if (pagedPaintDevice) {
-        QPageLayout::Orientation orientation = pageOrientation;
-        if (getOrientation(pageSize.sizePoints()) == QPageLayout::Landscape) {
+        if (mAbort) {
+          break;
+        }
+        const PageResult result =
+            layoutPage(args, index, deviceDpi, outputFilePathTmpl);
+        qDebug().nospace() << "Export page " << (index + 1) << " to "
+                           << args.printerName % args.filePath.toStr() << "...";
+        if (!pagedPaintDevice->setPageSize(result.pageSize)) {
+          qCritical().nospace()
+              << "Failed to set page size for graphics export to "
+              << result.pageSize.name() << ".";
+        }
+        QPageLayout::Orientation orientation = result.orientation;
+        if (getOrientation(result.pageSize.sizePoints()) ==
+            QPageLayout::Landscape) {
           // QPagedPaintDevice orientation seems to be swapped if page size is
           // landscape (e.g. the Ledger/Tabloid page size).
           if (orientation == QPageLayout::Landscape) {
@@ -239,137 +247,56 @@ QString GraphicsExport::run(RunArgs args) noexcept {
         if (!pagedPaintDevice->setPageOrientation(orientation)) {
           qCritical() << "Failed to set page orientation for graphics export!";
         }
-      }
-
-      // Determine DPI.
-      int dpi;
-      if (printer) {
-        dpi = printer->resolution();
-      } else if (pdfWriter) {
-        dpi = pdfWriter->resolution();
-      } else {
-        dpi = page.second->getPixmapDpi();
-      }
-      const qreal pxScale = static_cast<qreal>(dpi) / Length(25400000).toPx();
-
-      // Calculate page margins in output device pixels.
-      const QMarginsF pageMarginsPx(
-          page.second->getMarginLeft()->toInch() * dpi,
-          page.second->getMarginTop()->toInch() * dpi,
-          page.second->getMarginRight()->toInch() * dpi,
-          page.second->getMarginBottom()->toInch() * dpi);
-
-      // Determine output page rect.
-      QRect pageRectPx = pageSize.rectPixels(dpi);
-      if (getOrientation(pageRectPx.size()) != pageOrientation) {
-        pageRectPx.setSize(pageRectPx.size().transposed());
-      }
-      const QRectF pageContentRectPx = pageRectPx - pageMarginsPx;
-
-      // Calculate final scale factor.
-      const qreal scale = page.second->getScale()
-          ? pxScale
-          : qMin(pageContentRectPx.width() / sourceRectTransformedPx.width(),
-                 pageContentRectPx.height() / sourceRectTransformedPx.height());
-
-      // Determine output file path.
-      const FilePath outputFilePath = (!outputFilePathTmpl.isEmpty())
-          ? FilePath(outputFilePathTmpl.arg(index + 1))
-          : args.filePath;
-
-      // Last chance to abort before exporting.
-      emit progress(20 + std::ceil(percentPerPage * (index + qreal(0.5))),
-                    index + 1, args.pages.count());
-      if (mAbort) {
-        break;
-      }
-
-      // Prepare painter.
-      bool beginSuccess = false;
-      QScopedPointer<QSvgGenerator> svgGenerator;
-      QScopedPointer<QImage> image;
-      std::shared_ptr<QPicture> picture;
-      if (pagedPaintDevice) {
-        qDebug().nospace() << "Export page " << (index + 1) << " to "
-                           << args.printerName % args.filePath.toStr() << "...";
+        bool beginSuccess = false;
         if (index == 0) {
           beginSuccess = painter.begin(pagedPaintDevice);
         } else {
           beginSuccess = pagedPaintDevice->newPage();
         }
-      } else if (fileExt == "svg") {
-        qDebug().nospace() << "Export page " << (index + 1) << " as SVG to "
-                           << outputFilePath.toStr() << "...";
-        svgGenerator.reset(new QSvgGenerator());
-        svgGenerator->setTitle(mDocumentName);
-        svgGenerator->setFileName(outputFilePath.toStr());
-        svgGenerator->setSize(pageRectPx.size());
-        svgGenerator->setViewBox(pageRectPx);
-        svgGenerator->setResolution(dpi);
-        beginSuccess = painter.begin(svgGenerator.data());
-        emit savingFile(outputFilePath);
-      } else if (!args.preview) {
-        QString target =
-            outputFilePath.isValid() ? outputFilePath.toStr() : "clipboard";
-        qDebug().nospace() << "Export page " << (index + 1) << " as pixmap to "
-                           << target << "...";
-        image.reset(
-            new QImage(pageRectPx.size(), QImage::Format_ARGB32_Premultiplied));
-        image->fill(Qt::transparent);
-        beginSuccess = painter.begin(image.data());
-        painter.setRenderHints(QPainter::Antialiasing |
-                               QPainter::SmoothPixmapTransform);
-      } else {
-        qDebug().nospace() << "Generate preview of page " << index + 1 << "...";
-        picture = std::make_shared<QPicture>();
-        beginSuccess = painter.begin(picture.get());
-        painter.setRenderHints(QPainter::Antialiasing |
-                               QPainter::SmoothPixmapTransform);
-      }
-      if (!beginSuccess) {
-        throw RuntimeError(
-            __FILE__, __LINE__,
-            "Failed to start printing - invalid printer or output file?");
-      }
-
-      // Perform the export.
-      painter.save();
-      if (page.second->getBackgroundColor() != Qt::transparent) {
-        painter.fillRect(pageRectPx, page.second->getBackgroundColor());
-      }
-      painter.translate(pageContentRectPx.center().x(),
-                        pageContentRectPx.center().y());
-      painter.setTransform(sourceTransform, true);
-      painter.scale(scale, scale);
-      painter.translate(-sourceRectPx.center().x(), -sourceRectPx.center().y());
-      page.first->paint(painter, *page.second);
-      painter.restore();
-
-      // Finish painting of current page.
-      if ((!pagedPaintDevice) && (!painter.end())) {
-        throw RuntimeError(__FILE__, __LINE__, "Failed to finish painting.");
-      }
-      if (image && outputFilePath.isValid()) {
-        emit savingFile(outputFilePath);
-        if (!image->save(outputFilePath.toStr())) {
+        if (!beginSuccess) {
           throw RuntimeError(
               __FILE__, __LINE__,
-              tr("Failed to export image \"%1\". Check file permissions and "
-                 "make sure to use a supported image file extension.")
-                  .arg(outputFilePath.toNative()));
+              "Failed to start printing - invalid printer or output file?");
+        }
+        paintPage(painter, args.pages.at(index), result);
+      } else {
+        PageResult result;
+        if (futures.isEmpty()) {
+          result = renderPage(args, index, deviceDpi, outputFilePathTmpl);
+        } else {
+          result = futures.at(index).result();
+          futures[index] = QFuture<PageResult>();  // Release memory.
+        }
+        // Pages are also aborted if another page failed, so look for the
+        // error of a subsequent page before handling the abort.
+        for (int i = index + 1;
+             result.aborted && result.error.isNull() && (i < futures.count());
+             ++i) {
+          result.error = futures.at(i).result().error;
+        }
+        if (!result.error.isNull()) {
+          throw RuntimeError(__FILE__, __LINE__, result.error);
+        } else if (result.aborted) {
+          break;
+        }
+        if (result.picture) {
+          emit previewReady(index, result.pageRectPx.size(),
+                            result.pageContentRectPx, result.picture);
+        } else if (result.image) {
+          // Copy to clipboard must be performed in the main thread since
+          // QClipboard is not thread-safe. This is done by a queued
+          // signal-slot connection.
+          emit imageCopiedToClipboard(*result.image, QClipboard::Clipboard);
+        } else if (result.outputFilePath.isValid()) {
+          emit savingFile(result.outputFilePath);
+          FileUtils::writeFile(result.outputFilePath,
+                               result.fileContent);  // can throw
         }
-      } else if (image) {
-        // Copy to clipboard must be performed in the main thread since
-        // QClipboard is not thread-safe. This is done by a queued signal-slot
-        // connection.
-        emit imageCopiedToClipboard(*image, QClipboard::Clipboard);
-      }
-      if (picture) {
-        emit previewReady(index, pageRectPx.size(), pageContentRectPx, picture);
       }
       emit progress(20 + std::ceil(percentPerPage * (index + 1)), index + 1,
                     args.pages.count());
     }
+    abortGuard.dismiss();
 
     // Finish export.
     if ((pagedPaintDevice) && (!painter.end())) {
@@ -408,6 +335,178 @@ QString GraphicsExport::run(RunArgs args) noexcept {
   }
 }
 
+GraphicsExport::PageResult GraphicsExport::layoutPage(
+    const RunArgs& args, int index, int deviceDpi,
+    const QString& outputFilePathTmpl) noexcept {
+  const Page& page = args.pages.at(index);
+  PageResult result;
+  result.aborted = false;
+
+  // Determine source bounding rect.
+  result.sourceRectPx = calcSourceRect(*page.first, *page.second);
+  result.sourceTransform = getSourceTransformation(*page.second);
+  const QRectF sourceRectTransformedPx =
+      result.sourceTransform.mapRect(result.sourceRectPx);
+
+  // Determine output page size.
+  if (page.second->getPageSize() && page.second->getPageSize()->isValid()) {
+    // Fixed page size is specified.
+    result.pageSize = *page.second->getPageSize();
+  } else {
+    // Derive page size from source size.
+    Length width = Length::fromPx(sourceRectTransformedPx.width()) +
+        *page.second->getMarginLeft() + *page.second->getMarginRight();
+    Length height = Length::fromPx(sourceRectTransformedPx.height()) +
+        *page.second->getMarginTop() + *page.second->getMarginBottom();
+    result.pageSize =
+        QPageSize(QSizeF(width.toMm(), height.toMm()), QPageSize::Millimeter,
+                  "Custom", QPageSize::ExactMatch);
+  }
+
+  // Determine output page orientation.
+  result.orientation = page.second->getOrientation()
+      ? (*page.second->getOrientation())
+      : getOrientation(sourceRectTransformedPx.size());
+
+  // Determine DPI.
+  const int dpi = (deviceDpi > 0) ? deviceDpi : page.second->getPixmapDpi();
+  const qreal pxScale = static_cast<qreal>(dpi) / Length(25400000).toPx();
+  result.dpi = dpi;
+
+  // Calculate page margins in output device pixels.
+  const QMarginsF pageMarginsPx(page.second->getMarginLeft()->toInch() * dpi,
+                                page.second->getMarginTop()->toInch() * dpi,
+                                page.second->getMarginRight()->toInch() * dpi,
+                                page.second->getMarginBottom()->toInch() * dpi);
+
+  // Determine output page rect.
+  result.pageRectPx = result.pageSize.rectPixels(dpi);
+  if (getOrientation(result.pageRectPx.size()) != result.orientation) {
+    result.pageRectPx.setSize(result.pageRectPx.size().transposed());
+  }
+  result.pageContentRectPx = QRectF(result.pageRectPx) - pageMarginsPx;
+
+  // Calculate final scale factor.
+  result.scale = page.second->getScale()
+      ? pxScale
+      : qMin(result.pageContentRectPx.width() /
+                 sourceRectTransformedPx.width(),
+             result.pageContentRectPx.height() /
+                 sourceRectTransformedPx.height());
+
+  // Determine output file path.
+  result.outputFilePath = (!outputFilePathTmpl.isEmpty())
+      ? FilePath(outputFilePathTmpl.arg(index + 1))
+      : args.filePath;
+  return result;
+}
+
+GraphicsExport::PageResult GraphicsExport::renderPage(
+    const RunArgs& args, int index, int deviceDpi,
+    const QString& outputFilePathTmpl) noexcept {
+  // Note: This method is called from different threads at the same time,
+  //       thus be careful with calling other methods to only call thread-safe
+  //       methods!
+
+  PageResult result;
+  result.aborted = mAbort;
+  if (result.aborted) {
+    return result;
+  }
+
+  try {
+    const QString fileExt = args.filePath.getSuffix().toLower();
+    result = layoutPage(args, index, deviceDpi, outputFilePathTmpl);
+
+    // Last chance to abort before exporting.
+    result.aborted = mAbort;
+    if (result.aborted) {
+      return result;
+    }
+
+    // Prepare painter. Files are only rendered into memory, they are written
+    // by the export thread in the order of the pages.
+    QPainter painter;
+    bool beginSuccess = false;
+    QBuffer svgBuffer(&result.fileContent);
+    QScopedPointer<QSvgGenerator> svgGenerator;
+    if (fileExt == "svg") {
+      qDebug().nospace() << "Export page " << (index + 1) << " as SVG to "
+                         << result.outputFilePath.toStr() << "...";
+      svgGenerator.reset(new QSvgGenerator());
+      svgGenerator->setTitle(mDocumentName);
+      svgGenerator->setOutputDevice(&svgBuffer);
+      svgGenerator->setSize(result.pageRectPx.size());
+      svgGenerator->setViewBox(result.pageRectPx);
+      svgGenerator->setResolution(result.dpi);
+      beginSuccess = painter.begin(svgGenerator.data());
+    } else if (!args.preview) {
+      QString target = result.outputFilePath.isValid()
+          ? result.outputFilePath.toStr()
+          : "clipboard";
+      qDebug().nospace() << "Export page " << (index + 1) << " as pixmap to "
+                         << target << "...";
+      result.image = std::make_shared<QImage>(
+          result.pageRectPx.size(), QImage::Format_ARGB32_Premultiplied);
+      result.image->fill(Qt::transparent);
+      beginSuccess = painter.begin(result.image.get());
+      painter.setRenderHints(QPainter::Antialiasing |
+                             QPainter::SmoothPixmapTransform);
+    } else {
+      qDebug().nospace() << "Generate preview of page " << index + 1 << "...";
+      result.picture = std::make_shared<QPicture>();
+      beginSuccess = painter.begin(result.picture.get());
+      painter.setRenderHints(QPainter::Antialiasing |
+                             QPainter::SmoothPixmapTransform);
+    }
+    if (!beginSuccess) {
+      throw RuntimeError(
+          __FILE__, __LINE__,
+          "Failed to start printing - invalid printer or output file?");
+    }
+
+    // Perform the export.
+    paintPage(painter, args.pages.at(index), result);
+
+    // Finish painting of current page.
+    if (!painter.end()) {
+      throw RuntimeError(__FILE__, __LINE__, "Failed to finish painting.");
+    }
+    if (result.image && result.outputFilePath.isValid()) {
+      QBuffer imageBuffer(&result.fileContent);
+      imageBuffer.open(QIODevice::WriteOnly);
+      if (!result.image->save(&imageBuffer, qPrintable(fileExt))) {
+        throw RuntimeError(
+            __FILE__, __LINE__,
+            tr("Failed to export image \"%1\". Check file permissions and "
+               "make sure to use a supported image file extension.")
+                .arg(result.outputFilePath.toNative()));
+      }
+      result.image.reset();  // Not needed anymore, release memory.
+    }
+  } catch (const Exception& e) {
+    result.error = e.getMsg().isEmpty() ? "Unknown error" : e.getMsg();
+    mAbort = true;  // Don't render any further pages.
+  }
+  return result;
+}
+
+void GraphicsExport::paintPage(QPainter& painter, const Page& page,
+                               const PageResult& result) noexcept {
+  painter.save();
+  if (page.second->getBackgroundColor() != Qt::transparent) {
+    painter.fillRect(result.pageRectPx, page.second->getBackgroundColor());
+  }
+  painter.translate(result.pageContentRectPx.center().x(),
+                    result.pageContentRectPx.center().y());
+  painter.setTransform(result.sourceTransform, true);
+  painter.scale(result.scale, result.scale);
+  painter.translate(-result.sourceRectPx.center().x(),
+                    -result.sourceRectPx.center().y());
+  page.first->paint(painter, *page.second);
+  painter.restore();
+}
+
 QTransform GraphicsExport::getSourceTransformation(
     const GraphicsExportSettings& settings) noexcept {
   QTransform t;
@@ -33,6 +33,7 @@
 #include <QtGui>
 #include <QtPrintSupport>
 
+#include <atomic>
 #include <memory>
 
 /*******************************************************************************
@@ -111,6 +112,24 @@ public:
    */
   void setDocumentName(const QString& name) noexcept { mDocumentName = name; }
 
+  /**
+   * @brief Set the maximum number of pages rendered concurrently
+   *
+   * Pages are independent of each other, so previews, images and SVGs are
+   * rendered in parallel by default (one thread per CPU core). The output
+   * files are written in the order of the pages, and signals are always
+   * emitted in the order of the pages. PDF and printer pages are painted
+   * directly on the output device, thus sequentially.
+   *
+   * @param count   Maximum number of threads. `1` disables parallel
+   *                rendering, i.e. all pages are rendered sequentially.
+   *
+   * @attention Must not be called while a job is running.
+   */
+  void setMaxThreadCount(int count) noexcept {
+    mMaxThreadCount = qMax(count, 1);
+  }
+
   /**
    * @brief Start creating previews asynchronously
    *
@@ -198,9 +217,31 @@ private:  // Types
     QPrinter::DuplexMode duplex;
     int copies;
   };
+  struct PageResult {
+    QRectF sourceRectPx;
+    QTransform sourceTransform;
+    QPageSize pageSize;
+    QPageLayout::Orientation orientation;
+    int dpi;
+    QRect pageRectPx;
+    QRectF pageContentRectPx;
+    qreal scale;
+    FilePath outputFilePath;
+    QByteArray fileContent;  ///< For image or SVG file
+    std::shared_ptr<QPicture> picture;  ///< For preview
+    std::shared_ptr<QImage> image;  ///< For clipboard
+    QString error;  ///< Null on success
+    bool aborted;
+  };
 
 private:  // Methods
   QString run(RunArgs args) noexcept;
+  static PageResult layoutPage(const RunArgs& args, int index, int deviceDpi,
+                               const QString& outputFilePathTmpl) noexcept;
+  PageResult renderPage(const RunArgs& args, int index, int deviceDpi,
+                        const QString& outputFilePathTmpl) noexcept;
+  static void paintPage(QPainter& painter, const Page& page,
+                        const PageResult& result) noexcept;
   static QTransform getSourceTransformation(
       const GraphicsExportSettings& settings) noexcept;
   static QRectF calcSourceRect(const GraphicsPagePainter& page,
@@ -210,8 +251,9 @@ private:  // Methods
 private:  // Data
   QString mCreator;
   QString mDocumentName;
+  int mMaxThreadCount;
   QFuture<QString> mFuture;
-  bool mAbort;
+  std::atomic<bool> mAbort;
 };
 
 /*******************************************************************************
@@ -30,6 +30,8 @@
 #include <quazip/quazipdir.h>
 #include <quazip/quazipfile.h>
 
+#include <QtConcurrent>
+
 /*******************************************************************************
  *  Namespace
  ******************************************************************************/
@@ -73,6 +75,9 @@ TransactionalFileSystem::TransactionalFileSystem(
 }
 
 TransactionalFileSystem::~TransactionalFileSystem() noexcept {
+  // The directory lock must not be released while an autosave is written.
+  waitForAutosave();
+
   // Remove autosave directory as it is not needed in case the file system
   // was gracefully closed. We only need it if the application has crashed.
   // But if the file system is opened in read-only mode, or if an autosave was
@@ -167,7 +172,15 @@ QByteArray TransactionalFileSystem::read(const QString& path) const {
   if (mModifiedFiles.contains(cleanedPath)) {
     return mModifiedFiles.value(cleanedPath);
   } else if (!isRemoved(cleanedPath)) {
-    return FileUtils::readFile(mFilePath.getPathTo(cleanedPath));  // can throw
+    QByteArray content =
+        FileUtils::readFile(mFilePath.getPathTo(cleanedPath));  // can throw
+    if (mIsWritable) {
+      // Note: Only writable file systems are saved, so there's no need to
+      // remember the hashes otherwise (and keep read() free of side effects,
+      // read-only file systems may be accessed from different threads).
+      mDiskFileHashes.insert(cleanedPath, calcHash(content));
+    }
+    return content;
   } else {
     throw RuntimeError(__FILE__, __LINE__,
                        tr("File '%1' does not exist.")
@@ -178,8 +191,13 @@ QByteArray TransactionalFileSystem::read(const QString& path) const {
 void TransactionalFileSystem::write(const QString& path,
                                     const QByteArray& content) {
   QString cleanedPath = cleanPath(path);
-  mModifiedFiles[cleanedPath] = content;
   mRemovedFiles.remove(cleanedPath);
+  if ((!isRemoved(cleanedPath)) && isEqualToDisk(cleanedPath, content)) {
+    // Content equals the file on the disk, so there's nothing to save.
+    mModifiedFiles.remove(cleanedPath);
+  } else {
+    mModifiedFiles[cleanedPath] = content;
+  }
 }
 
 void TransactionalFileSystem::removeFile(const QString& path) {
@@ -305,12 +323,10 @@ QStringList TransactionalFileSystem::checkForModifications() const {
   }
 
   // new or modified files
-  foreach (const QString& filepath, mModifiedFiles.keys()) {
-    FilePath fp = mFilePath.getPathTo(filepath);
-    QByteArray content = mModifiedFiles.value(filepath);
-    if ((!fp.isExistingFile()) ||
-        (FileUtils::readFile(fp) != content)) {  // can throw
-      modifications.append(filepath);
+  for (auto it = mModifiedFiles.constBegin(); it != mModifiedFiles.constEnd();
+       ++it) {
+    if (!isEqualToDisk(it.key(), it.value())) {
+      modifications.append(it.key());
     }
   }
 
@@ -318,10 +334,36 @@ QStringList TransactionalFileSystem::checkForModifications() const {
 }
 
 void TransactionalFileSystem::autosave() {
+  waitForAutosave();
   saveDiff("autosave");  // can throw
 }
 
+QFuture<bool> TransactionalFileSystem::autosaveAsync() {
+  waitForAutosave();
+
+  // Capture the modifications on the calling thread, only the (slow) file
+  // system access is done in the background.
+  Diff diff = prepareDiff("autosave");  // can throw
+  mAutosaveFuture = QtConcurrent::run([diff]() {
+    try {
+      writeDiff(diff);  // can throw
+      return true;
+    } catch (const Exception& e) {
+      qCritical() << "Failed to write autosave backup:" << e.getMsg();
+      return false;
+    }
+  });
+  return mAutosaveFuture;
+}
+
+void TransactionalFileSystem::waitForAutosave() noexcept {
+  mAutosaveFuture.waitForFinished();
+}
+
 void TransactionalFileSystem::save() {
+  // make sure no autosave is written in parallel
+  waitForAutosave();
+
   // save to backup directory
   saveDiff("backup");  // can throw
 
@@ -339,6 +381,13 @@ void TransactionalFileSystem::save() {
     if (fp.isExistingDir()) {
       FileUtils::removeDirRecursively(fp);  // can throw
     }
+    for (auto it = mDiskFileHashes.begin(); it != mDiskFileHashes.end();) {
+      if (it.key().startsWith(dir)) {
+        it = mDiskFileHashes.erase(it);
+      } else {
+        ++it;
+      }
+    }
   }
 
   // remove files
@@ -347,12 +396,15 @@ void TransactionalFileSystem::save() {
     if (fp.isExistingFile()) {
       FileUtils::removeFile(fp);  // can throw
     }
+    mDiskFileHashes.remove(filepath);
   }
 
   // save new or modified files
-  foreach (const QString& filepath, mModifiedFiles.keys()) {
-    FileUtils::writeFile(mFilePath.getPathTo(filepath),
-                         mModifiedFiles.value(filepath));  // can throw
+  for (auto it = mModifiedFiles.constBegin(); it != mModifiedFiles.constEnd();
+       ++it) {
+    FileUtils::writeFile(mFilePath.getPathTo(it.key()),
+                         it.value());  // can throw
+    mDiskFileHashes.insert(it.key(), calcHash(it.value()));
   }
 
   // remove backup
@@ -392,6 +444,32 @@ bool TransactionalFileSystem::isRemoved(const QString& path) const noexcept {
   return false;
 }
 
+bool TransactionalFileSystem::isEqualToDisk(const QString& path,
+                                            const QByteArray& content) const
+    noexcept {
+  auto it = mDiskFileHashes.constFind(path);
+  if (it == mDiskFileHashes.constEnd()) {
+    try {
+      FilePath fp = mFilePath.getPathTo(path);
+      if (!fp.isExistingFile()) {
+        return false;
+      }
+      it = mDiskFileHashes.insert(
+          path, calcHash(FileUtils::readFile(fp)));  // can throw
+    } catch (const Exception& e) {
+      qWarning() << "Failed to read file for modification check:"
+                 << e.getMsg();
+      return false;
+    }
+  }
+  return (*it) == calcHash(content);
+}
+
+QByteArray TransactionalFileSystem::calcHash(
+    const QByteArray& content) noexcept {
+  return QCryptographicHash::hash(content, QCryptographicHash::Md5);
+}
+
 void TransactionalFileSystem::exportDirToZip(QuaZipFile& file,
                                              const FilePath& zipFp,
                                              const QString& dir,
@@ -437,24 +515,31 @@ void TransactionalFileSystem::exportDirToZip(QuaZipFile& file,
 }
 
 void TransactionalFileSystem::saveDiff(const QString& type) const {
+  writeDiff(prepareDiff(type));  // can throw
+}
+
+TransactionalFileSystem::Diff TransactionalFileSystem::prepareDiff(
+    const QString& type) const {
   QDateTime dt = QDateTime::currentDateTime();
   FilePath dir = mFilePath.getPathTo("." % type);
-  FilePath filesDir = dir.getPathTo(dt.toString("yyyy-MM-dd_hh-mm-ss-zzz"));
 
   if (!mIsWritable) {
     throw RuntimeError(__FILE__, __LINE__, tr("File system is read-only."));
   }
 
+  Diff diff;
+  diff.indexFile = dir.getPathTo(type % ".lp");
+  diff.filesDir = dir.getPathTo(dt.toString("yyyy-MM-dd_hh-mm-ss-zzz"));
+  diff.modifiedFiles = mModifiedFiles;  // implicitly shared, no deep copy
+
   SExpression root = SExpression::createList("librepcb_" % type);
   root.ensureLineBreak();
   root.appendChild("created", dt);
   root.ensureLineBreak();
-  root.appendChild("modified_files_directory", filesDir.getFilename());
+  root.appendChild("modified_files_directory", diff.filesDir.getFilename());
   foreach (const QString& filepath, Toolbox::sorted(mModifiedFiles.keys())) {
     root.ensureLineBreak();
     root.appendChild("modified_file", filepath);
-    FileUtils::writeFile(filesDir.getPathTo(filepath),
-                         mModifiedFiles.value(filepath));  // can throw
   }
   foreach (const QString& filepath, Toolbox::sorted(mRemovedFiles.values())) {
     root.ensureLineBreak();
@@ -465,11 +550,20 @@ void TransactionalFileSystem::saveDiff(const QString& type) const {
     root.appendChild("removed_directory", filepath);
   }
   root.ensureLineBreak();
+  diff.index = root.toByteArray();
+  return diff;
+}
+
+void TransactionalFileSystem::writeDiff(const Diff& diff) {
+  for (auto it = diff.modifiedFiles.constBegin();
+       it != diff.modifiedFiles.constEnd(); ++it) {
+    FileUtils::writeFile(diff.filesDir.getPathTo(it.key()),
+                         it.value());  // can throw
+  }
 
   // Writing the main file must be the last operation to "mark" this diff as
   // complete!
-  FileUtils::writeFile(dir.getPathTo(type % ".lp"),
-                       root.toByteArray());  // can throw
+  FileUtils::writeFile(diff.indexFile, diff.index);  // can throw
 }
 
 void TransactionalFileSystem::loadDiff(const FilePath& fp) {
@@ -496,6 +590,8 @@ void TransactionalFileSystem::loadDiff(const FilePath& fp) {
 }
 
 void TransactionalFileSystem::removeDiff(const QString& type) {
+  waitForAutosave();
+
   FilePath dir = mFilePath.getPathTo("." % type);
   FilePath file = dir.getPathTo(type % ".lp");
 
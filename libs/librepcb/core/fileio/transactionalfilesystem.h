@@ -60,6 +60,17 @@ namespace librepcb {
  *  - Holds all file modifications in memory and allows to write those in an
  *    atomic way to the disk (see @ref doc_project_save).
  *  - Allows to export the whole file system to a ZIP file.
+ *
+ * To avoid writing files which did not change at all, the content hashes of
+ * the files on the disk are remembered when reading or saving them. Writing
+ * a file with the same content as on the disk does not add it to the list of
+ * modified files, so it is neither written by #save() nor by #autosave().
+ *
+ * With #autosaveAsync(), the current modifications are captured on the
+ * calling thread (cheap thanks to Qt's implicit sharing) while the files are
+ * written to the disk on a background thread. The autosave index file is
+ * still written last, so an interrupted autosave never gets restored. All
+ * other write operations wait for a pending autosave to be finished.
  */
 class TransactionalFileSystem final : public FileSystem {
   Q_OBJECT
@@ -150,6 +161,9 @@ public:
   const FilePath& getPath() const noexcept { return mFilePath; }
   bool isWritable() const noexcept { return mIsWritable; }
   bool isRestoredFromAutosave() const noexcept { return mRestoredFromAutosave; }
+  bool isAutosaveInProgress() const noexcept {
+    return mAutosaveFuture.isRunning();
+  }
 
   // Inherited from FileSystem
   virtual FilePath getAbsPath(const QString& path = "") const noexcept override;
@@ -170,6 +184,8 @@ public:
   void discardChanges() noexcept;
   QStringList checkForModifications() const;
   void autosave();
+  QFuture<bool> autosaveAsync();
+  void waitForAutosave() noexcept;
   void save();
 
   // Static Methods
@@ -196,11 +212,25 @@ public:
   }
   static QString cleanPath(QString path) noexcept;
 
+private:  // Types
+  /// Snapshot of all modifications, to be written as a diff to the disk
+  struct Diff {
+    FilePath indexFile;  ///< The index file (e.g. ".autosave/autosave.lp")
+    FilePath filesDir;  ///< Directory for the modified files
+    QHash<QString, QByteArray> modifiedFiles;  ///< Modified files to write
+    QByteArray index;  ///< Content of the index file
+  };
+
 private:  // Methods
   bool isRemoved(const QString& path) const noexcept;
+  bool isEqualToDisk(const QString& path, const QByteArray& content) const
+      noexcept;
+  static QByteArray calcHash(const QByteArray& content) noexcept;
   void exportDirToZip(QuaZipFile& file, const FilePath& zipFp,
                       const QString& dir, FilterFunction filter) const;
   void saveDiff(const QString& type) const;
+  Diff prepareDiff(const QString& type) const;
+  static void writeDiff(const Diff& diff);
   void loadDiff(const FilePath& fp);
   void removeDiff(const QString& type);
 
@@ -214,6 +244,13 @@ private:  // Data
   QHash<QString, QByteArray> mModifiedFiles;
   QSet<QString> mRemovedFiles;
   QSet<QString> mRemovedDirs;
+
+  /// Content hashes of files on the disk (only those which were read or
+  /// written through this object, used to detect unmodified files)
+  mutable QHash<QString, QByteArray> mDiskFileHashes;
+
+  /// The currently running (or last finished) asynchronous autosave
+  QFuture<bool> mAutosaveFuture;
 };
 
 /*******************************************************************************
@@ -410,13 +410,14 @@ Path Path::flatArc(const Point& p1, const Point& p2, const Angle& angle,
   Point center = Toolbox::arcCenter(p1, p2, angle);
 
   // create line segments
-  Path p;
-  p.addVertex(p1);
+  QVector<Vertex> vertices;
+  vertices.reserve(steps + 1);
+  vertices.append(Vertex(p1));
   for (int i = 1; i < steps; ++i) {
-    p.addVertex(p1.rotated(Angle(angleDelta * i), center));
+    vertices.append(Vertex(p1.rotated(Angle(angleDelta * i), center)));
   }
-  p.addVertex(p2);
-  return p;
+  vertices.append(Vertex(p2));
+  return Path(vertices);
 }
 
 QPainterPath Path::toQPainterPathPx(const QVector<Path>& paths,
@@ -40,8 +40,11 @@ namespace librepcb {
 
 /**
  * @brief The Vertex class
+ *
+ * @note Like ::librepcb::Point, this class intentionally does not inherit from
+ *       ::librepcb::SerializableObject to keep paths as compact as possible.
  */
-class Vertex final : public SerializableObject {
+class Vertex final {
 public:
   // Constructors / Destructor
   Vertex() noexcept : mPos(), mAngle() {}
@@ -61,8 +64,15 @@ public:
   void setAngle(const Angle& angle) noexcept { mAngle = angle; }
 
   // General Methods
+  /// @copydoc ::librepcb::SerializableObject::serializeToDomElement()
+  SExpression serializeToDomElement(const QString& name) const {
+    SExpression root = SExpression::createList(name);
+    serialize(root);
+    return root;
+  }
+
   /// @copydoc ::librepcb::SerializableObject::serialize()
-  void serialize(SExpression& root) const override;
+  void serialize(SExpression& root) const;
 
   // Operator Overloadings
   Vertex& operator=(const Vertex& rhs) noexcept;
@@ -103,4 +113,6 @@ inline uint qHash(const Vertex& key, uint seed = 0) noexcept {
 
 }  // namespace librepcb
 
+Q_DECLARE_TYPEINFO(librepcb::Vertex, Q_MOVABLE_TYPE);
+
 #endif
@@ -37,7 +37,7 @@ namespace librepcb {
  ******************************************************************************/
 
 GraphicsScene::GraphicsScene() noexcept
-  : QGraphicsScene(nullptr), mSelectionRectItem(nullptr) {
+  : QGraphicsScene(nullptr), mSelectionRectItem(nullptr), mOverlayItems() {
   /*QBrush selectBrush = QGuiApplication::palette().highlight();
   QColor selectColor = selectBrush.color();
   selectColor.setAlpha(50);
@@ -48,6 +48,7 @@ GraphicsScene::GraphicsScene() noexcept
   mSelectionRectItem->setBrush(selectBrush);
   mSelectionRectItem->setZValue(1000);
   QGraphicsScene::addItem(mSelectionRectItem);
+  mOverlayItems.insert(mSelectionRectItem);
 }
 
 GraphicsScene::~GraphicsScene() noexcept {
@@ -56,6 +57,19 @@ GraphicsScene::~GraphicsScene() noexcept {
   mSelectionRectItem = nullptr;
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+bool GraphicsScene::isOverlayItem(const QGraphicsItem& item) const noexcept {
+  for (const QGraphicsItem* i = &item; i; i = i->parentItem()) {
+    if (mOverlayItems.contains(i)) {
+      return true;
+    }
+  }
+  return false;
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
@@ -65,9 +79,25 @@ void GraphicsScene::addItem(QGraphicsItem& item) noexcept {
 }
 
 void GraphicsScene::removeItem(QGraphicsItem& item) noexcept {
+  mOverlayItems.remove(&item);
   QGraphicsScene::removeItem(&item);
 }
 
+void GraphicsScene::setOverlayItem(QGraphicsItem& item, bool overlay) noexcept {
+  if (overlay == mOverlayItems.contains(&item)) {
+    return;
+  }
+  if (overlay) {
+    mOverlayItems.insert(&item);
+  } else {
+    mOverlayItems.remove(&item);
+  }
+  if (item.scene() == this) {
+    emit overlayItemChanged(item.sceneBoundingRect().united(
+        item.mapRectToScene(item.childrenBoundingRect())));
+  }
+}
+
 void GraphicsScene::setSelectionRect(const Point& p1,
                                      const Point& p2) noexcept {
   QRectF rectPx = QRectF(p1.toPxQPointF(), p2.toPxQPointF()).normalized();
@@ -48,17 +48,46 @@ public:
   explicit GraphicsScene() noexcept;
   ~GraphicsScene() noexcept;
 
+  // Getters
+  const QSet<const QGraphicsItem*>& getOverlayItems() const noexcept {
+    return mOverlayItems;
+  }
+  bool isOverlayItem(const QGraphicsItem& item) const noexcept;
+
   // General Methods
   void addItem(QGraphicsItem& item) noexcept;
   void removeItem(QGraphicsItem& item) noexcept;
+
+  /**
+   * @brief Mark an item as overlay item, or remove this mark
+   *
+   * Overlay items (including their children) are expected to change often,
+   * e.g. the selection rectangle or items being dragged around. Views
+   * caching the rendered scene do not cache them but draw them on top of
+   * the cached content.
+   *
+   * @param item      The item to (un)mark. Removing the item from the scene
+   *                  removes the mark as well.
+   * @param overlay   Whether the item is an overlay item or not.
+   */
+  void setOverlayItem(QGraphicsItem& item, bool overlay) noexcept;
   void setSelectionRect(const Point& p1, const Point& p2) noexcept;
   QPixmap toPixmap(int dpi,
                    const QColor& background = Qt::transparent) noexcept;
   QPixmap toPixmap(const QSize& size,
                    const QColor& background = Qt::transparent) noexcept;
 
+signals:
+  /**
+   * @brief An item has been marked or unmarked as overlay item
+   *
+   * @param rect  Scene rect of the item, including its children.
+   */
+  void overlayItemChanged(const QRectF& rect);
+
 private:
   QGraphicsRectItem* mSelectionRectItem;
+  QSet<const QGraphicsItem*> mOverlayItems;
 };
 
 /*******************************************************************************
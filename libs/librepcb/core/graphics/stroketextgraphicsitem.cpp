@@ -22,7 +22,6 @@
  ******************************************************************************/
 #include "stroketextgraphicsitem.h"
 
-#include "../attribute/attributesubstitutor.h"
 #include "../graphics/graphicslayer.h"
 #include "origincrossgraphicsitem.h"
 
@@ -47,6 +46,8 @@ StrokeTextGraphicsItem::StrokeTextGraphicsItem(
     mFont(font),
     mAttributeProvider(nullptr),
     mSubstitutedText(),
+    mAttributeDependencies(),
+    mSubstitutionValid(false),
     mOnEditedSlot(*this, &StrokeTextGraphicsItem::strokeTextEdited) {
   // add origin cross
   mOriginCrossGraphicsItem.reset(new OriginCrossGraphicsItem(this));
@@ -76,16 +77,29 @@ void StrokeTextGraphicsItem::setAttributeProvider(
     const AttributeProvider* provider) noexcept {
   if (provider != mAttributeProvider) {
     mAttributeProvider = provider;
+    mSubstitutionValid = false;
     updateText();
   }
 }
 
 void StrokeTextGraphicsItem::updateText() noexcept {
+  // Attribute changes are signalled very often (e.g. for every modification
+  // of the project metadata), so skip the substitution if none of the
+  // attributes referenced by this text has changed its value.
+  if (mSubstitutionValid &&
+      AttributeSubstitutor::isUpToDate(mAttributeDependencies,
+                                       mAttributeProvider)) {
+    return;
+  }
+
   QString text = mText.getText();
   if (mAttributeProvider) {
-    text =
-        AttributeSubstitutor::substitute(mText.getText(), mAttributeProvider);
+    text = AttributeSubstitutor::substitute(
+        mText.getText(), mAttributeProvider, nullptr, &mAttributeDependencies);
+  } else {
+    mAttributeDependencies.clear();
   }
+  mSubstitutionValid = true;
   if (text != mSubstitutedText) {
     mSubstitutedText = text;
     updatePaths();
@@ -100,6 +114,18 @@ QPainterPath StrokeTextGraphicsItem::shape() const noexcept {
   return PrimitivePathGraphicsItem::shape() + mOriginCrossGraphicsItem->shape();
 }
 
+void StrokeTextGraphicsItem::paint(QPainter* painter,
+                                   const QStyleOptionGraphicsItem* option,
+                                   QWidget* widget) noexcept {
+  // Texts smaller than a few pixels are not readable anyway, so skip them to
+  // avoid drawing lots of tiny strokes when zoomed out of a dense board.
+  const qreal lod =
+      option->levelOfDetailFromTransform(painter->worldTransform());
+  if ((mText.getHeight()->toPx() * lod) >= 2) {
+    PrimitivePathGraphicsItem::paint(painter, option, widget);
+  }
+}
+
 /*******************************************************************************
  *  Private Methods
  ******************************************************************************/
@@ -111,6 +137,7 @@ void StrokeTextGraphicsItem::strokeTextEdited(
       updateLayer(text.getLayerName());
       break;
     case StrokeText::Event::TextChanged:
+      mSubstitutionValid = false;
       updateText();
       break;
     case StrokeText::Event::HeightChanged:
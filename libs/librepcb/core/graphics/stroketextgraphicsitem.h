@@ -23,6 +23,7 @@
 /*******************************************************************************
  *  Includes
  ******************************************************************************/
+#include "../attribute/attributesubstitutor.h"
 #include "../geometry/stroketext.h"
 #include "primitivepathgraphicsitem.h"
 
@@ -65,6 +66,8 @@ public:
 
   // Inherited from QGraphicsItem
   QPainterPath shape() const noexcept override;
+  void paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
+             QWidget* widget = 0) noexcept override;
 
   // Operator Overloadings
   StrokeTextGraphicsItem& operator=(const StrokeTextGraphicsItem& rhs) = delete;
@@ -88,6 +91,11 @@ private:  // Data
   const AttributeProvider* mAttributeProvider;
   QString mSubstitutedText;
 
+  /// Attributes #mSubstitutedText depends on (only valid if
+  /// #mSubstitutionValid is true)
+  AttributeSubstitutor::Dependencies mAttributeDependencies;
+  bool mSubstitutionValid;
+
   // Slots
   StrokeText::OnEditedSlot mOnEditedSlot;
 };
@@ -22,7 +22,6 @@
  ******************************************************************************/
 #include "textgraphicsitem.h"
 
-#include "../attribute/attributesubstitutor.h"
 #include "../graphics/graphicslayer.h"
 #include "../utils/toolbox.h"
 #include "origincrossgraphicsitem.h"
@@ -46,6 +45,8 @@ TextGraphicsItem::TextGraphicsItem(Text& text,
     mText(text),
     mLayerProvider(lp),
     mAttributeProvider(nullptr),
+    mAttributeDependencies(),
+    mSubstitutionValid(false),
     mOnEditedSlot(*this, &TextGraphicsItem::textEdited) {
   setFont(TextGraphicsItem::Font::SansSerif);
   setPosition(mText.getPosition());
@@ -89,15 +90,27 @@ void TextGraphicsItem::setAttributeProvider(
     const AttributeProvider* provider) noexcept {
   if (provider != mAttributeProvider) {
     mAttributeProvider = provider;
+    mSubstitutionValid = false;
     updateText();
   }
 }
 
 void TextGraphicsItem::updateText() noexcept {
+  // Skip the substitution if no referenced attribute has changed its value.
+  if (mSubstitutionValid &&
+      AttributeSubstitutor::isUpToDate(mAttributeDependencies,
+                                       mAttributeProvider)) {
+    return;
+  }
+
   QString text = mText.getText();
   if (mAttributeProvider) {
-    text = AttributeSubstitutor::substitute(text, mAttributeProvider);
+    text = AttributeSubstitutor::substitute(text, mAttributeProvider, nullptr,
+                                            &mAttributeDependencies);
+  } else {
+    mAttributeDependencies.clear();
   }
+  mSubstitutionValid = true;
   setText(text);
 }
 
@@ -112,6 +125,7 @@ void TextGraphicsItem::textEdited(const Text& text,
       setLayer(mLayerProvider.getLayer(*text.getLayerName()));
       break;
     case Text::Event::TextChanged:
+      mSubstitutionValid = false;
       updateText();
       break;
     case Text::Event::PositionChanged:
@@ -23,6 +23,7 @@
 /*******************************************************************************
  *  Includes
  ******************************************************************************/
+#include "../attribute/attributesubstitutor.h"
 #include "../geometry/text.h"
 #include "primitivetextgraphicsitem.h"
 
@@ -81,6 +82,11 @@ private:  // Data
   /// Object for substituting placeholders in text
   const AttributeProvider* mAttributeProvider;
 
+  /// Attributes the displayed text depends on (only valid if
+  /// #mSubstitutionValid is true)
+  AttributeSubstitutor::Dependencies mAttributeDependencies;
+  bool mSubstitutionValid;
+
   // Slots
   Text::OnEditedSlot mOnEditedSlot;
 };
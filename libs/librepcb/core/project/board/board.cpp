@@ -29,6 +29,7 @@
 #include "../../library/cmp/component.h"
 #include "../../library/pkg/footprint.h"
 #include "../../serialization/sexpression.h"
+#include "../../tracer.h"
 #include "../../types/gridproperties.h"
 #include "../../types/lengthunit.h"
 #include "../../utils/scopeguardlist.h"
@@ -37,13 +38,18 @@
 #include "../circuit/componentinstance.h"
 #include "../circuit/netsignal.h"
 #include "../erc/ercmsg.h"
+#include "../erc/ercmsglist.h"
 #include "../project.h"
+#include "../projectcache.h"
 #include "boardairwiresbuilder.h"
 #include "boarddesignrules.h"
 #include "boardfabricationoutputsettings.h"
 #include "boardlayerstack.h"
+#include "boardplanefragmentsbuilder.h"
 #include "boardselectionquery.h"
 #include "boardusersettings.h"
+#include "drc/boardcopperconnectivity.h"
+#include "drc/boardcoppergeometrycache.h"
 #include "items/bi_airwire.h"
 #include "items/bi_device.h"
 #include "items/bi_footprint.h"
@@ -57,6 +63,7 @@
 #include "items/bi_stroketext.h"
 #include "items/bi_via.h"
 
+#include <QtConcurrent>
 #include <QtCore>
 #include <QtWidgets>
 
@@ -78,9 +85,16 @@ Board::Board(const Board& other,
     mProject(other.getProject()),
     mDirectory(std::move(directory)),
     mIsAddedToProject(false),
+    mIsModified(true),
+    mCopperGeometryCache(new BoardCopperGeometryCache(*this)),
+    mShortCircuitsCheckOutdated(false),
+    mBatchUpdateDepth(0),
+    mSelectionRectActive(false),
     mUuid(Uuid::createRandom()),
     mName(name),
-    mDefaultFontFileName(other.mDefaultFontFileName) {
+    mDefaultFontFileName(other.mDefaultFontFileName),
+    mPlaneInputItemsValid(false),
+    mPlanesCacheOutdated(false) {
   try {
     mGraphicsScene.reset(new GraphicsScene());
 
@@ -144,7 +158,6 @@ Board::Board(const Board& other,
 
     // rebuildAllPlanes(); --> fragments are copied too, so no need to rebuild
     // them
-    updateErcMessages();
     updateIcon();
 
     // emit the "attributesChanged" signal when the project has emitted it
@@ -152,11 +165,35 @@ Board::Board(const Board& other,
             &Board::attributesChanged);
 
     connect(&mProject.getCircuit(), &Circuit::componentAdded, this,
-            &Board::updateErcMessages);
+            &Board::scheduleErcMessagesUpdate);
     connect(&mProject.getCircuit(), &Circuit::componentRemoved, this,
-            &Board::updateErcMessages);
+            &Board::scheduleErcMessagesUpdate);
+
+    // the selectability of items depends on the layer visibility
+    foreach (const GraphicsLayer* layer, mLayerStack->getAllLayers()) {
+      connect(layer, &GraphicsLayer::attributesChanged, this,
+              &Board::invalidateSelectionRectItems);
+    }
+
+    // rebuild airwires which were skipped by the throttled rebuild
+    mAirWiresRebuildThrottleTimer.setSingleShot(true);
+    connect(&mAirWiresRebuildThrottleTimer, &QTimer::timeout, this, [this]() {
+      if (!mScheduledNetSignalsForAirWireRebuild.isEmpty()) {
+        triggerAirWiresRebuildThrottled();
+      }
+    });
+
+    // check for short circuits once the copper was not modified for a while
+    mShortCircuitsCheckTimer.setSingleShot(true);
+    mShortCircuitsCheckTimer.setInterval(500);
+    connect(&mShortCircuitsCheckTimer, &QTimer::timeout, this,
+            &Board::startShortCircuitsCheck);
+    connect(&mShortCircuitsCheckWatcher, &QFutureWatcher<bool>::finished,
+            this, &Board::shortCircuitsCheckFinished);
   } catch (...) {
     // free the allocated memory in the reverse order of their allocation...
+    qDeleteAll(mErcMsgListShortCircuits);
+    mErcMsgListShortCircuits.clear();
     qDeleteAll(mErcMsgListUnplacedComponentInstances);
     mErcMsgListUnplacedComponentInstances.clear();
     qDeleteAll(mAirWires);
@@ -190,8 +227,15 @@ Board::Board(Project& project,
     mProject(project),
     mDirectory(std::move(directory)),
     mIsAddedToProject(false),
+    mIsModified(true),
+    mCopperGeometryCache(new BoardCopperGeometryCache(*this)),
+    mShortCircuitsCheckOutdated(false),
+    mBatchUpdateDepth(0),
+    mSelectionRectActive(false),
     mUuid(Uuid::createRandom()),
-    mName("New Board") {
+    mName("New Board"),
+    mPlaneInputItemsValid(false),
+    mPlanesCacheOutdated(false) {
   try {
     mGraphicsScene.reset(new GraphicsScene());
 
@@ -226,7 +270,7 @@ Board::Board(Project& project,
                       Path::rect(Point(0, 0), Point(100000000, 80000000)));
       mPolygons.append(new BI_Polygon(*this, polygon));
     } else {
-      SExpression root = SExpression::parse(
+      SExpression root = mProject.getCache().parse(
           mDirectory->read(getFilePath().getFilename()), getFilePath());
 
       // the board seems to be ready to open, so we will create all needed
@@ -327,8 +371,11 @@ Board::Board(Project& project,
       }
     }
 
-    rebuildAllPlanes();
-    updateErcMessages();
+    // Rebuilding the planes is expensive, so reuse the fragments from the
+    // project cache if none of their inputs has changed.
+    if (!restorePlanesFromCache()) {
+      rebuildAllPlanes();
+    }
     updateIcon();
 
     // emit the "attributesChanged" signal when the project has emitted it
@@ -336,11 +383,35 @@ Board::Board(Project& project,
             &Board::attributesChanged);
 
     connect(&mProject.getCircuit(), &Circuit::componentAdded, this,
-            &Board::updateErcMessages);
+            &Board::scheduleErcMessagesUpdate);
     connect(&mProject.getCircuit(), &Circuit::componentRemoved, this,
-            &Board::updateErcMessages);
+            &Board::scheduleErcMessagesUpdate);
+
+    // the selectability of items depends on the layer visibility
+    foreach (const GraphicsLayer* layer, mLayerStack->getAllLayers()) {
+      connect(layer, &GraphicsLayer::attributesChanged, this,
+              &Board::invalidateSelectionRectItems);
+    }
+
+    // rebuild airwires which were skipped by the throttled rebuild
+    mAirWiresRebuildThrottleTimer.setSingleShot(true);
+    connect(&mAirWiresRebuildThrottleTimer, &QTimer::timeout, this, [this]() {
+      if (!mScheduledNetSignalsForAirWireRebuild.isEmpty()) {
+        triggerAirWiresRebuildThrottled();
+      }
+    });
+
+    // check for short circuits once the copper was not modified for a while
+    mShortCircuitsCheckTimer.setSingleShot(true);
+    mShortCircuitsCheckTimer.setInterval(500);
+    connect(&mShortCircuitsCheckTimer, &QTimer::timeout, this,
+            &Board::startShortCircuitsCheck);
+    connect(&mShortCircuitsCheckWatcher, &QFutureWatcher<bool>::finished,
+            this, &Board::shortCircuitsCheckFinished);
   } catch (...) {
     // free the allocated memory in the reverse order of their allocation...
+    qDeleteAll(mErcMsgListShortCircuits);
+    mErcMsgListShortCircuits.clear();
     qDeleteAll(mErcMsgListUnplacedComponentInstances);
     mErcMsgListUnplacedComponentInstances.clear();
     qDeleteAll(mAirWires);
@@ -369,7 +440,10 @@ Board::Board(Project& project,
 
 Board::~Board() noexcept {
   Q_ASSERT(!mIsAddedToProject);
+  mProject.getErcMsgList().cancelScheduledUpdate(*this);
 
+  qDeleteAll(mErcMsgListShortCircuits);
+  mErcMsgListShortCircuits.clear();
   qDeleteAll(mErcMsgListUnplacedComponentInstances);
   mErcMsgListUnplacedComponentInstances.clear();
 
@@ -462,8 +536,24 @@ QList<BI_Base*> Board::getAllItems() const noexcept {
  *  Setters: General
  ******************************************************************************/
 
+void Board::setModified(bool modified) noexcept {
+  mIsModified = modified;
+}
+
 void Board::setGridProperties(const GridProperties& grid) noexcept {
   *mGridProperties = grid;
+  setModified(true);
+}
+
+void Board::setDesignRules(const BoardDesignRules& rules) noexcept {
+  *mDesignRules = rules;
+  setModified(true);
+}
+
+void Board::setFabricationOutputSettings(
+    const BoardFabricationOutputSettings& settings) noexcept {
+  *mFabricationOutputSettings = settings;
+  setModified(true);
 }
 
 /*******************************************************************************
@@ -490,7 +580,9 @@ void Board::addDeviceInstance(BI_Device& instance) {
   // add to board
   instance.addToBoard();  // can throw
   mDeviceInstances.insert(instance.getComponentInstanceUuid(), &instance);
-  updateErcMessages();
+  invalidateSelectionRectItems();
+  setModified(true);
+  scheduleErcMessagesUpdate();
   emit deviceAdded(instance);
 }
 
@@ -502,7 +594,9 @@ void Board::removeDeviceInstance(BI_Device& instance) {
   // remove from board
   instance.removeFromBoard();  // can throw
   mDeviceInstances.remove(instance.getComponentInstanceUuid());
-  updateErcMessages();
+  invalidateSelectionRectItems();
+  setModified(true);
+  scheduleErcMessagesUpdate();
   emit deviceRemoved(instance);
 }
 
@@ -532,6 +626,8 @@ void Board::addNetSegment(BI_NetSegment& netsegment) {
   // add to board
   netsegment.addToBoard();  // can throw
   mNetSegments.append(&netsegment);
+  invalidateSelectionRectItems();
+  setModified(true);
 }
 
 void Board::removeNetSegment(BI_NetSegment& netsegment) {
@@ -541,6 +637,8 @@ void Board::removeNetSegment(BI_NetSegment& netsegment) {
   // remove from board
   netsegment.removeFromBoard();  // can throw
   mNetSegments.removeOne(&netsegment);
+  invalidateSelectionRectItems();
+  setModified(true);
 }
 
 /*******************************************************************************
@@ -554,6 +652,8 @@ void Board::addPlane(BI_Plane& plane) {
   }
   plane.addToBoard();  // can throw
   mPlanes.append(&plane);
+  invalidateSelectionRectItems();
+  setModified(true);
 }
 
 void Board::removePlane(BI_Plane& plane) {
@@ -562,15 +662,110 @@ void Board::removePlane(BI_Plane& plane) {
   }
   plane.removeFromBoard();  // can throw
   mPlanes.removeOne(&plane);
+  invalidateSelectionRectItems();
+  setModified(true);
 }
 
 void Board::rebuildAllPlanes() noexcept {
+  const TraceZone traceZone("Board::rebuildAllPlanes");
   QList<BI_Plane*> planes = mPlanes;
   std::sort(planes.begin(), planes.end(),
             [](const BI_Plane* p1, const BI_Plane* p2) {
               return !(*p1 < *p2);
             });  // sort by priority (highest priority first)
   foreach (BI_Plane* plane, planes) { plane->rebuild(); }
+  mPlanesCacheOutdated = true;
+  storePlaneInputItems();
+}
+
+int Board::rebuildModifiedPlanes() noexcept {
+  const TraceZone traceZone("Board::rebuildModifiedPlanes");
+  if (!mPlaneInputItemsValid) {
+    rebuildAllPlanes();
+    return mPlanes.count();
+  }
+
+  // Determine modified regions by comparing the current plane inputs with
+  // the inputs of the last rebuild.
+  typedef BoardPlaneFragmentsBuilder::InputItem InputItem;
+  const QHash<QString, InputItem> items =
+      BoardPlaneFragmentsBuilder::collectInputItems(*this);
+  QVector<QPair<QString, QRectF>> dirtyRegions;  // Empty layer = all layers
+  for (auto it = items.constBegin(); it != items.constEnd(); ++it) {
+    auto oldIt = mPlaneInputItems.constFind(it.key());
+    if (oldIt == mPlaneInputItems.constEnd()) {
+      dirtyRegions.append(qMakePair(it->layerName, it->boundingRect));
+    } else if (oldIt->data != it->data) {
+      dirtyRegions.append(qMakePair(oldIt->layerName, oldIt->boundingRect));
+      dirtyRegions.append(qMakePair(it->layerName, it->boundingRect));
+    }
+  }
+  for (auto it = mPlaneInputItems.constBegin();
+       it != mPlaneInputItems.constEnd(); ++it) {
+    if (!items.contains(it.key())) {
+      dirtyRegions.append(qMakePair(it->layerName, it->boundingRect));
+    }
+  }
+
+  // Rebuild affected planes in the same order as rebuildAllPlanes(). Since
+  // planes only subtract planes of higher priority, marking the fragments
+  // of each rebuilt plane as modified updates dependent planes transitively.
+  auto fragmentsRect = [](const BI_Plane& plane) {
+    QRectF rect;
+    foreach (const Path& path, plane.getFragments()) {
+      rect |= path.toQPainterPathPx().boundingRect();
+    }
+    return rect;
+  };
+  QList<BI_Plane*> planes = mPlanes;
+  std::sort(planes.begin(), planes.end(),
+            [](const BI_Plane* p1, const BI_Plane* p2) {
+              return !(*p1 < *p2);
+            });  // sort by priority (highest priority first)
+  int rebuiltPlanes = 0;
+  foreach (BI_Plane* plane, planes) {
+    // Objects affect the fragments up to the clearance (cut-outs) plus the
+    // minimum width (removal of thin areas) away from them. Add one
+    // millimeter to be on the safe side regarding rounding of arcs.
+    const qreal margin =
+        (*plane->getMinClearance() + *plane->getMinWidth() + Length(1000000))
+            .toPx();
+    const QRectF area =
+        plane->getOutline().toQPainterPathPx().boundingRect().adjusted(
+            -margin, -margin, margin, margin);
+    bool affected = false;
+    foreach (const auto& region, dirtyRegions) {
+      const bool onLayer = region.first.isEmpty() ||
+          (region.first == *plane->getLayerName());
+      if (onLayer && (region.second.left() <= area.right()) &&
+          (region.second.right() >= area.left()) &&
+          (region.second.top() <= area.bottom()) &&
+          (region.second.bottom() >= area.top())) {
+        affected = true;
+        break;
+      }
+    }
+    if (affected) {
+      const QString layerName = *plane->getLayerName();
+      const QRectF oldFragments = fragmentsRect(*plane);
+      plane->rebuild();
+      const QRectF newFragments = fragmentsRect(*plane);
+      if (!oldFragments.isNull()) {
+        dirtyRegions.append(qMakePair(layerName, oldFragments));
+      }
+      if (!newFragments.isNull()) {
+        dirtyRegions.append(qMakePair(layerName, newFragments));
+      }
+      ++rebuiltPlanes;
+    }
+  }
+
+  if (rebuiltPlanes > 0) {
+    mPlanesCacheOutdated = true;
+  }
+  mPlaneInputItems = items;
+  Tracer::counter("Rebuilt planes", rebuiltPlanes);
+  return rebuiltPlanes;
 }
 
 /*******************************************************************************
@@ -584,6 +779,8 @@ void Board::addPolygon(BI_Polygon& polygon) {
   }
   polygon.addToBoard();  // can throw
   mPolygons.append(&polygon);
+  invalidateSelectionRectItems();
+  setModified(true);
 }
 
 void Board::removePolygon(BI_Polygon& polygon) {
@@ -592,6 +789,8 @@ void Board::removePolygon(BI_Polygon& polygon) {
   }
   polygon.removeFromBoard();  // can throw
   mPolygons.removeOne(&polygon);
+  invalidateSelectionRectItems();
+  setModified(true);
 }
 
 /*******************************************************************************
@@ -605,6 +804,8 @@ void Board::addStrokeText(BI_StrokeText& text) {
   }
   text.addToBoard();  // can throw
   mStrokeTexts.append(&text);
+  invalidateSelectionRectItems();
+  setModified(true);
 }
 
 void Board::removeStrokeText(BI_StrokeText& text) {
@@ -613,6 +814,8 @@ void Board::removeStrokeText(BI_StrokeText& text) {
   }
   text.removeFromBoard();  // can throw
   mStrokeTexts.removeOne(&text);
+  invalidateSelectionRectItems();
+  setModified(true);
 }
 
 /*******************************************************************************
@@ -626,6 +829,8 @@ void Board::addHole(BI_Hole& hole) {
   }
   hole.addToBoard();  // can throw
   mHoles.append(&hole);
+  invalidateSelectionRectItems();
+  setModified(true);
 }
 
 void Board::removeHole(BI_Hole& hole) {
@@ -634,6 +839,8 @@ void Board::removeHole(BI_Hole& hole) {
   }
   hole.removeFromBoard();  // can throw
   mHoles.removeOne(&hole);
+  invalidateSelectionRectItems();
+  setModified(true);
 }
 
 /*******************************************************************************
@@ -641,6 +848,7 @@ void Board::removeHole(BI_Hole& hole) {
  ******************************************************************************/
 
 void Board::triggerAirWiresRebuild() noexcept {
+  const TraceZone traceZone("Board::triggerAirWiresRebuild");
   if (!mIsAddedToProject) {
     return;
   }
@@ -674,6 +882,24 @@ void Board::triggerAirWiresRebuild() noexcept {
   }
 }
 
+void Board::triggerAirWiresRebuildThrottled() noexcept {
+  // Rebuilding airwires more often than the display refreshes is wasted time,
+  // e.g. when dragging many items. So rebuild them immediately only if the
+  // last throttled rebuild is at least one frame ago, otherwise the timer
+  // will rebuild them (once) after that time has elapsed.
+  if (mAirWiresRebuildThrottleTimer.isActive()) {
+    return;
+  }
+  int interval = 16;  // Fallback: ~60Hz
+  if (const QScreen* screen = QGuiApplication::primaryScreen()) {
+    if (screen->refreshRate() > 1) {
+      interval = qCeil(1000 / screen->refreshRate());
+    }
+  }
+  triggerAirWiresRebuild();
+  mAirWiresRebuildThrottleTimer.start(interval);
+}
+
 void Board::forceAirWiresRebuild() noexcept {
   mScheduledNetSignalsForAirWireRebuild.unite(
       Toolbox::toSet(mProject.getCircuit().getNetSignals().values()));
@@ -681,6 +907,34 @@ void Board::forceAirWiresRebuild() noexcept {
   triggerAirWiresRebuild();
 }
 
+/*******************************************************************************
+ *  Short Circuit Methods
+ ******************************************************************************/
+
+void Board::scheduleShortCircuitsCheck() noexcept {
+  // Restart the timer on every modification, so the check runs only once
+  // after a series of modifications (e.g. while dragging items).
+  if (mIsAddedToProject) {
+    mShortCircuitsCheckOutdated = true;
+    mShortCircuitsCheckTimer.start();
+  }
+}
+
+/*******************************************************************************
+ *  Batch Update Methods
+ ******************************************************************************/
+
+void Board::endBatchUpdate() noexcept {
+  Q_ASSERT(mBatchUpdateDepth > 0);
+  if (--mBatchUpdateDepth == 0) {
+    // Now update each netline only once, even if several of its anchors have
+    // been moved during the batch update.
+    QSet<BI_NetLine*> netlines;
+    std::swap(netlines, mScheduledNetLineUpdates);
+    foreach (BI_NetLine* netline, netlines) { netline->updateLine(); }
+  }
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
@@ -698,7 +952,10 @@ void Board::addToProject() {
   }
   mIsAddedToProject = true;
   forceAirWiresRebuild();
-  updateErcMessages();
+  invalidateSelectionRectItems();
+  scheduleShortCircuitsCheck();
+  scheduleErcMessagesUpdate();
+  setModified(true);
   sgl.dismiss();
 }
 
@@ -714,18 +971,27 @@ void Board::removeFromProject() {
     sgl.add([item]() { item->addToBoard(); });
   }
   mIsAddedToProject = false;
-  updateErcMessages();
+  mShortCircuitsCheckTimer.stop();
+  invalidateSelectionRectItems();
+  qDeleteAll(mErcMsgListShortCircuits);
+  mErcMsgListShortCircuits.clear();
+  scheduleErcMessagesUpdate();
+  setModified(true);
   sgl.dismiss();
 }
 
 void Board::save() {
   if (mIsAddedToProject) {
-    // save board file
-    SExpression brdDoc(serializeToDomElement("librepcb_board"));  // can throw
-    mDirectory->write(getFilePath().getFilename(),
-                      brdDoc.toByteArray());  // can throw
+    // save board file, if modified
+    if (mIsModified) {
+      SExpression brdDoc(
+          serializeToDomElement("librepcb_board"));  // can throw
+      mDirectory->write(getFilePath().getFilename(),
+                        brdDoc.toByteArray());  // can throw
+    }
 
-    // save user settings
+    // save user settings (always, since changes like toggling the layer
+    // visibility don't mark the board as modified)
     mUserSettings->resetPlanesVisibility();
     foreach (BI_Plane* plane, mPlanes) {
       mUserSettings->setPlaneVisibility(plane->getUuid(), plane->isVisible());
@@ -736,6 +1002,13 @@ void Board::save() {
   } else {
     mDirectory->removeDirRecursively();  // can throw
   }
+  setModified(false);
+}
+
+void Board::saveToCache() noexcept {
+  if (mIsAddedToProject && mPlanesCacheOutdated) {
+    storePlanesInCache();
+  }
 }
 
 void Board::selectAll() noexcept {
@@ -758,50 +1031,65 @@ void Board::selectAll() noexcept {
 void Board::setSelectionRect(const Point& p1, const Point& p2,
                              bool updateItems) noexcept {
   mGraphicsScene->setSelectionRect(p1, p2);
-  if (updateItems) {
-    QRectF rectPx = QRectF(p1.toPxQPointF(), p2.toPxQPointF()).normalized();
-    foreach (BI_Device* component, mDeviceInstances) {
-      BI_Footprint& footprint = component->getFootprint();
-      bool selectFootprint = footprint.isSelectable() &&
-          footprint.getGrabAreaScenePx().intersects(rectPx);
-      footprint.setSelected(selectFootprint);
-      foreach (BI_FootprintPad* pad, footprint.getPads()) {
-        bool selectPad =
-            pad->isSelectable() && pad->getGrabAreaScenePx().intersects(rectPx);
-        pad->setSelected(selectFootprint || selectPad);
-      }
-      foreach (BI_StrokeText* text, footprint.getStrokeTexts()) {
-        bool selectText = text->isSelectable() &&
-            text->getGrabAreaScenePx().intersects(rectPx);
-        text->setSelected(selectFootprint || selectText);
-      }
-    }
-    foreach (BI_NetSegment* segment, mNetSegments) {
-      segment->setSelectionRect(rectPx);
+  if (!updateItems) {
+    // drawing the selection rectangle is finished (or aborted)
+    mSelectionRectItems.clear();
+    mSelectionRectActive = false;
+    return;
+  }
+
+  if (!mSelectionRectActive) {
+    initSelectionRectItems();
+    mSelectionRectPx = QRectF();
+    mSelectionRectActive = true;
+  }
+
+  // Only items touching the area between the previous and the new rectangle
+  // can change their selection state, so the (expensive) intersection test is
+  // skipped for all other items.
+  const QRectF oldRectPx = mSelectionRectPx;
+  const QRectF newRectPx =
+      QRectF(p1.toPxQPointF(), p2.toPxQPointF()).normalized();
+  auto touches = [](const QRectF& a, const QRectF& b) {
+    // unlike QRectF::intersects(), this also works for zero-sized rects
+    return (a.left() <= b.right()) && (b.left() <= a.right()) &&
+        (a.top() <= b.bottom()) && (b.top() <= a.bottom());
+  };
+  for (SelectionRectItem& entry : mSelectionRectItems) {
+    if (entry.grabArea.isEmpty()) {
+      continue;  // not selectable
     }
-    foreach (BI_Plane* plane, mPlanes) {
-      bool select = plane->isSelectable() &&
-          plane->getGrabAreaScenePx().intersects(rectPx);
-      plane->setSelected(select);
+    if (!touches(entry.boundingRect, newRectPx)) {
+      entry.intersects = false;
+      continue;
     }
-    foreach (BI_Polygon* polygon, mPolygons) {
-      bool select = polygon->isSelectable() &&
-          polygon->getGrabAreaScenePx().intersects(rectPx);
-      polygon->setSelected(select);
+    if (oldRectPx.contains(entry.boundingRect) &&
+        newRectPx.contains(entry.boundingRect)) {
+      continue;
     }
-    foreach (BI_StrokeText* text, mStrokeTexts) {
-      bool select =
-          text->isSelectable() && text->getGrabAreaScenePx().intersects(rectPx);
-      text->setSelected(select);
+    entry.intersects = entry.grabArea.intersects(newRectPx);
+  }
+  mSelectionRectPx = newRectPx;
+
+  // Only update items whose selection state actually changes to avoid
+  // needless repaints. Footprints are processed before their pads and texts
+  // since selecting a footprint also selects all of its pads and texts.
+  for (const SelectionRectItem& entry : mSelectionRectItems) {
+    bool select = entry.intersects;
+    if (entry.footprintIndex >= 0) {
+      select |= mSelectionRectItems.at(entry.footprintIndex).intersects;
     }
-    foreach (BI_Hole* hole, mHoles) {
-      bool select =
-          hole->isSelectable() && hole->getGrabAreaScenePx().intersects(rectPx);
-      hole->setSelected(select);
+    if (entry.item->isSelected() != select) {
+      entry.item->setSelected(select);
     }
   }
 }
 
+void Board::invalidateSelectionRectItems() noexcept {
+  mSelectionRectItems.clear();
+  mSelectionRectActive = false;
+}
+
 void Board::clearSelection() const noexcept {
   foreach (BI_Device* device, mDeviceInstances)
     device->getFootprint().setSelected(false);
@@ -844,6 +1132,126 @@ QVector<const AttributeProvider*> Board::getAttributeProviderParents() const
  *  Private Methods
  ******************************************************************************/
 
+void Board::initSelectionRectItems() noexcept {
+  mSelectionRectItems.clear();
+  auto add = [this](BI_Base& item, int footprintIndex) {
+    SelectionRectItem entry;
+    entry.item = &item;
+    entry.footprintIndex = footprintIndex;
+    if (item.isSelectable()) {
+      entry.grabArea = item.getGrabAreaScenePx();
+      entry.boundingRect = entry.grabArea.boundingRect();
+    }
+    entry.intersects = false;
+    mSelectionRectItems.append(entry);
+  };
+  foreach (BI_Device* device, mDeviceInstances) {
+    BI_Footprint& footprint = device->getFootprint();
+    const int footprintIndex = mSelectionRectItems.count();
+    add(footprint, -1);
+    foreach (BI_FootprintPad* pad, footprint.getPads()) {
+      add(*pad, footprintIndex);
+    }
+    foreach (BI_StrokeText* text, footprint.getStrokeTexts()) {
+      add(*text, footprintIndex);
+    }
+  }
+  foreach (BI_NetSegment* segment, mNetSegments) {
+    foreach (BI_Via* via, segment->getVias()) { add(*via, -1); }
+    foreach (BI_NetPoint* netpoint, segment->getNetPoints()) {
+      add(*netpoint, -1);
+    }
+    foreach (BI_NetLine* netline, segment->getNetLines()) {
+      add(*netline, -1);
+    }
+  }
+  foreach (BI_Plane* plane, mPlanes) { add(*plane, -1); }
+  foreach (BI_Polygon* polygon, mPolygons) { add(*polygon, -1); }
+  foreach (BI_StrokeText* text, mStrokeTexts) { add(*text, -1); }
+  foreach (BI_Hole* hole, mHoles) { add(*hole, -1); }
+}
+
+bool Board::restorePlanesFromCache() noexcept {
+  const QByteArray data = mProject.getCache().get(
+      getPlanesCacheKey(), BoardPlaneFragmentsBuilder::calcInputHash(*this));
+  if (data.isNull()) {
+    return false;
+  }
+
+  QDataStream stream(data);
+  QHash<QString, QVector<Path>> fragments;
+  quint32 planeCount = 0;
+  stream >> planeCount;
+  for (quint32 i = 0; (i < planeCount) && (stream.status() == QDataStream::Ok);
+       ++i) {
+    QString uuid;
+    quint32 pathCount = 0;
+    stream >> uuid >> pathCount;
+    QVector<Path>& paths = fragments[uuid];
+    for (quint32 k = 0;
+         (k < pathCount) && (stream.status() == QDataStream::Ok); ++k) {
+      Path path;
+      quint32 vertexCount = 0;
+      stream >> vertexCount;
+      for (quint32 v = 0;
+           (v < vertexCount) && (stream.status() == QDataStream::Ok); ++v) {
+        qint64 x = 0, y = 0;
+        qint32 angle = 0;
+        stream >> x >> y >> angle;
+        path.addVertex(Point(Length(x), Length(y)), Angle(angle));
+      }
+      paths.append(path);
+    }
+  }
+  if (stream.status() != QDataStream::Ok) {
+    qWarning() << "Ignoring invalid plane fragments in project cache.";
+    return false;
+  }
+  foreach (const BI_Plane* plane, mPlanes) {
+    if (!fragments.contains(plane->getUuid().toStr())) {
+      return false;
+    }
+  }
+  foreach (BI_Plane* plane, mPlanes) {
+    plane->setFragments(fragments.value(plane->getUuid().toStr()));
+  }
+  storePlaneInputItems();
+  mPlanesCacheOutdated = false;
+  return true;
+}
+
+void Board::storePlaneInputItems() noexcept {
+  mPlaneInputItems = BoardPlaneFragmentsBuilder::collectInputItems(*this);
+  mPlaneInputItemsValid = true;
+}
+
+void Board::storePlanesInCache() noexcept {
+  const TraceZone traceZone("Board::storePlanesInCache");
+  QByteArray data;
+  QDataStream stream(&data, QIODevice::WriteOnly);
+  stream << static_cast<quint32>(mPlanes.count());
+  foreach (const BI_Plane* plane, mPlanes) {
+    stream << plane->getUuid().toStr()
+           << static_cast<quint32>(plane->getFragments().count());
+    foreach (const Path& path, plane->getFragments()) {
+      stream << static_cast<quint32>(path.getVertices().count());
+      for (const Vertex& vertex : path.getVertices()) {
+        stream << static_cast<qint64>(vertex.getPos().getX().toNm())
+               << static_cast<qint64>(vertex.getPos().getY().toNm())
+               << vertex.getAngle().toMicroDeg();
+      }
+    }
+  }
+  mProject.getCache().set(getPlanesCacheKey(),
+                          BoardPlaneFragmentsBuilder::calcInputHash(*this),
+                          data);
+  mPlanesCacheOutdated = false;
+}
+
+QString Board::getPlanesCacheKey() const noexcept {
+  return "planes:" % getFilePath().toRelative(mProject.getPath());
+}
+
 void Board::updateIcon() noexcept {
   mIcon = QIcon(mGraphicsScene->toPixmap(QSize(297, 210), Qt::white));
 }
@@ -878,7 +1286,87 @@ void Board::serialize(SExpression& root) const {
   root.ensureEmptyLine();
 }
 
-void Board::updateErcMessages() noexcept {
+void Board::scheduleErcMessagesUpdate() noexcept {
+  mProject.getErcMsgList().scheduleUpdate(*this);
+}
+
+void Board::startShortCircuitsCheck() noexcept {
+  const TraceZone traceZone("Board::startShortCircuitsCheck");
+  if ((!mIsAddedToProject) || mShortCircuitsCheckWatcher.isRunning()) {
+    return;  // Restarted by shortCircuitsCheckFinished() if needed.
+  }
+
+  try {
+    std::shared_ptr<BoardCopperConnectivity> connectivity =
+        std::make_shared<BoardCopperConnectivity>(
+            *this, BoardCopperGeometryCache::maxArcTolerance());
+    connectivity->addItems();  // can throw
+    mShortCircuitsCheck = connectivity;
+    mShortCircuitsCheckOutdated = false;
+    mShortCircuitsCheckWatcher.setFuture(QtConcurrent::run([connectivity]() {
+      const TraceZone traceZone("Board::checkShortCircuits");
+      try {
+        connectivity->buildClusters();  // can throw
+        return true;
+      } catch (const Exception& e) {
+        qCritical() << "Failed to check for short circuits:" << e.getMsg();
+        return false;
+      }
+    }));
+  } catch (const Exception& e) {
+    qCritical() << "Failed to check for short circuits:" << e.getMsg();
+  }
+}
+
+void Board::shortCircuitsCheckFinished() noexcept {
+  std::shared_ptr<BoardCopperConnectivity> connectivity;
+  std::swap(connectivity, mShortCircuitsCheck);
+  if ((!connectivity) || (!mIsAddedToProject) ||
+      (!mShortCircuitsCheckWatcher.result())) {
+    return;
+  }
+  if (mShortCircuitsCheckOutdated) {
+    // The net signals referenced by the result might not exist anymore.
+    mShortCircuitsCheckTimer.start();
+    return;
+  }
+
+  try {
+    // Note: The locations of the short circuits are not needed here, so
+    // avoid calculating them in the GUI thread.
+    QSet<QString> keys;
+    foreach (const auto& nets, connectivity->getShortCircuitNets()) {
+      QStringList netUuids = {nets.first->getUuid().toStr(),
+                              nets.second->getUuid().toStr()};
+      netUuids.sort();
+      const QString key =
+          QString("%1/%2").arg(mUuid.toStr(), netUuids.join("/"));
+      if (keys.contains(key)) {
+        continue;
+      }
+      keys.insert(key);
+      if (!mErcMsgListShortCircuits.contains(key)) {
+        ErcMsg* ercMsg = new ErcMsg(
+            mProject, *this, key, "ShortCircuit",
+            ErcMsg::ErcMsgType_t::BoardError,
+            QString("Short circuit: %1 <-> %2 (Board: %3)")
+                .arg(*nets.first->getName(), *nets.second->getName(),
+                     *mName));
+        ercMsg->setVisible(true);
+        mErcMsgListShortCircuits.insert(key, ercMsg);
+      }
+    }
+    foreach (const QString& key, mErcMsgListShortCircuits.keys()) {
+      if (!keys.contains(key)) {
+        delete mErcMsgListShortCircuits.take(key);
+      }
+    }
+  } catch (const Exception& e) {
+    qCritical() << "Failed to check for short circuits:" << e.getMsg();
+  }
+}
+
+void Board::updateScheduledErcMessages() noexcept {
   // type: UnplacedComponent (ComponentInstances without DeviceInstance)
   if (mIsAddedToProject) {
     const QMap<Uuid, ComponentInstance*>& componentInstances =
@@ -31,6 +31,7 @@
 #include "../../types/length.h"
 #include "../../types/uuid.h"
 #include "../erc/if_ercmsgprovider.h"
+#include "boardplanefragmentsbuilder.h"
 
 #include <QtCore>
 #include <QtWidgets>
@@ -54,6 +55,8 @@ class BI_Plane;
 class BI_Polygon;
 class BI_StrokeText;
 class BI_Via;
+class BoardCopperConnectivity;
+class BoardCopperGeometryCache;
 class BoardDesignRules;
 class BoardFabricationOutputSettings;
 class BoardLayerStack;
@@ -132,13 +135,12 @@ public:
   GraphicsScene& getGraphicsScene() const noexcept { return *mGraphicsScene; }
   BoardLayerStack& getLayerStack() noexcept { return *mLayerStack; }
   const BoardLayerStack& getLayerStack() const noexcept { return *mLayerStack; }
-  BoardDesignRules& getDesignRules() noexcept { return *mDesignRules; }
+  BoardCopperGeometryCache& getCopperGeometryCache() const noexcept {
+    return *mCopperGeometryCache;
+  }
   const BoardDesignRules& getDesignRules() const noexcept {
     return *mDesignRules;
   }
-  BoardFabricationOutputSettings& getFabricationOutputSettings() noexcept {
-    return *mFabricationOutputSettings;
-  }
   const BoardFabricationOutputSettings& getFabricationOutputSettings() const
       noexcept {
     return *mFabricationOutputSettings;
@@ -152,8 +154,31 @@ public:
       const QSet<const NetSignal*>& netsignals = {}) const noexcept;
   QList<BI_Base*> getAllItems() const noexcept;
 
+  /**
+   * @brief Check whether the board was modified since it was saved the last
+   *        time
+   *
+   * Used by #save() to skip serializing the board file if it is unmodified.
+   *
+   * @return Whether the board needs to be saved or not
+   */
+  bool isModified() const noexcept { return mIsModified; }
+
   // Setters: General
   void setGridProperties(const GridProperties& grid) noexcept;
+  void setDesignRules(const BoardDesignRules& rules) noexcept;
+  void setFabricationOutputSettings(
+      const BoardFabricationOutputSettings& settings) noexcept;
+
+  /**
+   * @brief Mark the board as modified (or unmodified)
+   *
+   * All methods modifying the board content call this automatically, so
+   * normally it doesn't need to be called from outside.
+   *
+   * @param modified  Whether the board content differs from the saved files
+   */
+  void setModified(bool modified) noexcept;
 
   // Getters: Attributes
   const Uuid& getUuid() const noexcept { return mUuid; }
@@ -185,6 +210,21 @@ public:
   void removePlane(BI_Plane& plane);
   void rebuildAllPlanes() noexcept;
 
+  /**
+   * @brief Rebuild only the planes affected by modifications
+   *
+   * Compares the plane inputs (see
+   * ::librepcb::BoardPlaneFragmentsBuilder::collectInputItems()) with the
+   * state of the last rebuild, and rebuilds only the planes whose outline
+   * overlaps a modified region on their layer. Whenever a plane is rebuilt,
+   * the area of its old and new fragments is considered as modified for
+   * all planes with lower priority. If there is no previous state (e.g.
+   * after copying a board), all planes are rebuilt.
+   *
+   * @return Number of rebuilt planes.
+   */
+  int rebuildModifiedPlanes() noexcept;
+
   // Polygon Methods
   const QList<BI_Polygon*>& getPolygons() const noexcept { return mPolygons; }
   void addPolygon(BI_Polygon& polygon);
@@ -208,17 +248,62 @@ public:
     mScheduledNetSignalsForAirWireRebuild.insert(netsignal);
   }
   void triggerAirWiresRebuild() noexcept;
+  void triggerAirWiresRebuildThrottled() noexcept;
   void forceAirWiresRebuild() noexcept;
 
+  // Short Circuit Methods
+
+  /**
+   * @brief Schedule a check for short circuits between different nets
+   *
+   * Called whenever copper of the board is modified. The check starts once
+   * the board was not modified for a short time, and reports every pair of
+   * shorted nets as a board ERC message. Only the copper objects are
+   * collected in the GUI thread, the connectivity is determined in a worker
+   * thread.
+   */
+  void scheduleShortCircuitsCheck() noexcept;
+
+  // Batch Update Methods
+  void beginBatchUpdate() noexcept { ++mBatchUpdateDepth; }
+  void endBatchUpdate() noexcept;
+  bool isBatchUpdateActive() const noexcept { return mBatchUpdateDepth > 0; }
+  void scheduleNetLineUpdate(BI_NetLine& netline) noexcept {
+    mScheduledNetLineUpdates.insert(&netline);
+  }
+  void unscheduleNetLineUpdate(BI_NetLine& netline) noexcept {
+    mScheduledNetLineUpdates.remove(&netline);
+  }
+
   // General Methods
   void addToProject();
   void removeFromProject();
   void save();
+
+  /**
+   * @brief Store derived data (e.g. plane fragments) in the project cache
+   *
+   * Calculating the cache key requires hashing the whole board, thus it is
+   * only done if the data was modified since the last call, and should be
+   * called only right before the cache gets written (see
+   * ::librepcb::Project::saveCache()).
+   */
+  void saveToCache() noexcept;
   void saveViewSceneRect(const QRectF& rect) noexcept { mViewRect = rect; }
   const QRectF& restoreViewSceneRect() const noexcept { return mViewRect; }
   void selectAll() noexcept;
   void setSelectionRect(const Point& p1, const Point& p2,
                         bool updateItems) noexcept;
+
+  /**
+   * @brief Discard the cached items of a currently drawn selection rectangle
+   *
+   * Must be called whenever items are added to or removed from the board, or
+   * when their selectability changes (e.g. layer visibility), since the cache
+   * holds raw pointers to the items. The cache is rebuilt on the next call to
+   * #setSelectionRect().
+   */
+  void invalidateSelectionRectItems() noexcept;
   void clearSelection() const noexcept;
   std::unique_ptr<BoardSelectionQuery> createSelectionQuery() const noexcept;
 
@@ -248,10 +333,33 @@ signals:
   void deviceRemoved(BI_Device& comp);
 
 private:
+  /**
+   * @brief Cached state of a selectable item during a rubber band selection
+   *
+   * The grab areas are determined only once when the selection rectangle is
+   * drawn the first time, since items can't be moved while the rectangle is
+   * drawn. See #setSelectionRect().
+   */
+  struct SelectionRectItem {
+    BI_Base* item;
+    int footprintIndex;  ///< Index of the item's footprint entry, or -1
+    QPainterPath grabArea;  ///< Scene grab area (empty if not selectable)
+    QRectF boundingRect;  ///< Bounding rect of #grabArea
+    bool intersects;  ///< Whether #grabArea intersects the selection rect
+  };
+
   Board(Project& project, std::unique_ptr<TransactionalDirectory> directory,
         const Version& fileFormat, bool create, const QString& newName);
+  void initSelectionRectItems() noexcept;
+  bool restorePlanesFromCache() noexcept;
+  void storePlaneInputItems() noexcept;
+  void storePlanesInCache() noexcept;
+  QString getPlanesCacheKey() const noexcept;
   void updateIcon() noexcept;
-  void updateErcMessages() noexcept;
+  void startShortCircuitsCheck() noexcept;
+  void shortCircuitsCheckFinished() noexcept;
+  void scheduleErcMessagesUpdate() noexcept;
+  void updateScheduledErcMessages() noexcept override;
 
   /// @copydoc ::librepcb::SerializableObject::serialize()
   void serialize(SExpression& root) const override;
@@ -260,15 +368,37 @@ private:
   Project& mProject;  ///< A reference to the Project object (from the ctor)
   std::unique_ptr<TransactionalDirectory> mDirectory;
   bool mIsAddedToProject;
+  bool mIsModified;  ///< Whether #save() needs to serialize the board
 
   QScopedPointer<GraphicsScene> mGraphicsScene;
   QScopedPointer<BoardLayerStack> mLayerStack;
+  /// Per-net copper areas, invalidated by the items when they are modified
+  QScopedPointer<BoardCopperGeometryCache> mCopperGeometryCache;
   QScopedPointer<GridProperties> mGridProperties;
   QScopedPointer<BoardDesignRules> mDesignRules;
   QScopedPointer<BoardFabricationOutputSettings> mFabricationOutputSettings;
   QScopedPointer<BoardUserSettings> mUserSettings;
   QRectF mViewRect;
   QSet<NetSignal*> mScheduledNetSignalsForAirWireRebuild;
+  QTimer mAirWiresRebuildThrottleTimer;
+  QTimer mShortCircuitsCheckTimer;
+  /// The running short circuits check, only accessed by the worker thread
+  /// until #mShortCircuitsCheckWatcher has finished
+  std::shared_ptr<BoardCopperConnectivity> mShortCircuitsCheck;
+  QFutureWatcher<bool> mShortCircuitsCheckWatcher;
+  /// Whether the copper was modified since the running check was started
+  bool mShortCircuitsCheckOutdated;
+
+  /// Nesting depth of #beginBatchUpdate() / #endBatchUpdate()
+  int mBatchUpdateDepth;
+  /// Netlines whose geometry update is deferred until #endBatchUpdate()
+  QSet<BI_NetLine*> mScheduledNetLineUpdates;
+
+  /// Items of the currently drawn selection rectangle (see
+  /// #setSelectionRect()), only valid if #mSelectionRectActive is true
+  QVector<SelectionRectItem> mSelectionRectItems;
+  QRectF mSelectionRectPx;  ///< The current selection rectangle
+  bool mSelectionRectActive;  ///< Whether a selection rect is being drawn
 
   // Attributes
   Uuid mUuid;
@@ -285,8 +415,16 @@ private:
   QList<BI_Hole*> mHoles;
   QMultiHash<NetSignal*, BI_AirWire*> mAirWires;
 
+  /// Plane inputs at the time of the last plane rebuild, only valid if
+  /// #mPlaneInputItemsValid is true (see #rebuildModifiedPlanes())
+  QHash<QString, BoardPlaneFragmentsBuilder::InputItem> mPlaneInputItems;
+  bool mPlaneInputItemsValid;
+  /// Whether the plane fragments need to be stored in the project cache
+  bool mPlanesCacheOutdated;
+
   // ERC messages
   QHash<Uuid, ErcMsg*> mErcMsgListUnplacedComponentInstances;
+  QHash<QString, ErcMsg*> mErcMsgListShortCircuits;
 };
 
 /*******************************************************************************
@@ -32,6 +32,7 @@
 #include "../../library/pkg/footprintpad.h"
 #include "../../library/pkg/package.h"
 #include "../../library/pkg/packagepad.h"
+#include "../../tracer.h"
 #include "../../utils/transform.h"
 #include "../circuit/componentinstance.h"
 #include "../circuit/componentsignalinstance.h"
@@ -97,6 +98,7 @@ FilePath BoardGerberExport::getOutputDirectory(
 
 void BoardGerberExport::exportPcbLayers(
     const BoardFabricationOutputSettings& settings) const {
+  const TraceZone traceZone("BoardGerberExport::exportPcbLayers");
   mWrittenFiles.clear();
 
   if (settings.getMergeDrillFiles()) {
@@ -123,6 +125,7 @@ void BoardGerberExport::exportPcbLayers(
 
 void BoardGerberExport::exportComponentLayer(BoardSide side,
                                              const FilePath& filePath) const {
+  const TraceZone traceZone("BoardGerberExport::exportComponentLayer");
   GerberGenerator gen(mCreationDateTime, mProjectName, mBoard.getUuid(),
                       mProject.getMetadata().getVersion());
   if (side == BoardSide::Top) {
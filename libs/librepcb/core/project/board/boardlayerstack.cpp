@@ -92,6 +92,7 @@ void BoardLayerStack::setInnerLayerCount(int count) noexcept {
         layer->setEnabled(layer->getInnerLayerNumber() <= mInnerLayerCount);
       }
     }
+    mBoard.setModified(true);
   }
 }
 
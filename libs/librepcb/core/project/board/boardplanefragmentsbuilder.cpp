@@ -25,8 +25,11 @@
 #include "../../graphics/graphicslayer.h"
 #include "../../library/pkg/footprint.h"
 #include "../../library/pkg/footprintpad.h"
+#include "../../tracer.h"
 #include "../../utils/clipperhelpers.h"
 #include "../../utils/transform.h"
+#include "../circuit/netsignal.h"
+#include "board.h"
 #include "items/bi_device.h"
 #include "items/bi_footprint.h"
 #include "items/bi_footprintpad.h"
@@ -40,6 +43,8 @@
 
 #include <QtCore>
 
+#include <functional>
+
 /*******************************************************************************
  *  Namespace
  ******************************************************************************/
@@ -61,6 +66,7 @@ BoardPlaneFragmentsBuilder::~BoardPlaneFragmentsBuilder() noexcept {
  ******************************************************************************/
 
 QVector<Path> BoardPlaneFragmentsBuilder::buildFragments() noexcept {
+  const TraceZone traceZone("BoardPlaneFragmentsBuilder::buildFragments");
   try {
     mResult.clear();
     addPlaneOutline();
@@ -79,6 +85,125 @@ QVector<Path> BoardPlaneFragmentsBuilder::buildFragments() noexcept {
   }
 }
 
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+QByteArray BoardPlaneFragmentsBuilder::calcInputHash(
+    const Board& board) noexcept {
+  // Derived from the input items to keep a single list of plane inputs.
+  // Sorted by key since the hash must not depend on the item order.
+  const QHash<QString, InputItem> items = collectInputItems(board);
+  QStringList keys = items.keys();
+  keys.sort();
+  QByteArray data;
+  QDataStream s(&data, QIODevice::WriteOnly);
+  foreach (const QString& key, keys) {
+    s << key << items[key].data;
+  }
+  return QCryptographicHash::hash(data, QCryptographicHash::Md5);
+}
+
+QHash<QString, BoardPlaneFragmentsBuilder::InputItem>
+    BoardPlaneFragmentsBuilder::collectInputItems(const Board& board) noexcept {
+  QHash<QString, InputItem> items;
+  auto addItem = [&items](const QString& key, const QString& layerName,
+                          const Path& outline,
+                          const std::function<void(QDataStream&)>& fields) {
+    InputItem item;
+    item.layerName = layerName;
+    item.boundingRect = outline.toQPainterPathPx().boundingRect();
+    QDataStream s(&item.data, QIODevice::WriteOnly);
+    s << layerName << static_cast<quint32>(outline.getVertices().count());
+    for (const Vertex& vertex : outline.getVertices()) {
+      s << static_cast<qint64>(vertex.getPos().getX().toNm())
+        << static_cast<qint64>(vertex.getPos().getY().toNm())
+        << vertex.getAngle().toMicroDeg();
+    }
+    if (fields) {
+      fields(s);
+    }
+    items.insert(key, item);
+  };
+  auto netUuid = [](const NetSignal* netsignal) {
+    return netsignal ? netsignal->getUuid().toStr() : QString();
+  };
+
+  // planes
+  foreach (const BI_Plane* plane, board.getPlanes()) {
+    addItem("plane:" % plane->getUuid().toStr(), *plane->getLayerName(),
+            plane->getOutline(), [&](QDataStream& s) {
+              s << plane->getPriority()
+                << static_cast<qint64>(plane->getMinWidth()->toNm())
+                << static_cast<qint64>(plane->getMinClearance()->toNm())
+                << plane->getKeepOrphans()
+                << static_cast<int>(plane->getConnectStyle())
+                << netUuid(&plane->getNetSignal());
+            });
+  }
+
+  // board outline
+  foreach (const BI_Polygon* polygon, board.getPolygons()) {
+    if (polygon->getPolygon().getLayerName() == GraphicsLayer::sBoardOutlines) {
+      addItem("outline:" % polygon->getUuid().toStr(), QString(),
+              polygon->getPolygon().getPath(), nullptr);
+    }
+  }
+
+  // devices
+  foreach (const BI_Device* device, board.getDeviceInstances()) {
+    const QString prefix = device->getComponentInstanceUuid().toStr() % ":";
+    Transform transform(*device);
+    for (const Polygon& polygon : device->getLibFootprint().getPolygons()) {
+      if (polygon.getLayerName() == GraphicsLayer::sBoardOutlines) {
+        addItem("outline:" % prefix % polygon.getUuid().toStr(), QString(),
+                transform.map(polygon.getPath()), nullptr);
+      }
+    }
+    for (const Hole& hole :
+         device->getFootprint().getLibFootprint().getHoles()) {
+      addItem("hole:" % prefix % hole.getUuid().toStr(), QString(),
+              Path::circle(hole.getDiameter())
+                  .translated(transform.map(hole.getPosition())),
+              nullptr);
+    }
+    foreach (const BI_FootprintPad* pad, device->getFootprint().getPads()) {
+      const bool tht =
+          (pad->getLibPad().getBoardSide() == FootprintPad::BoardSide::THT);
+      addItem("pad:" % prefix % pad->getLibPadUuid().toStr(),
+              tht ? QString() : pad->getLayerName(), pad->getSceneOutline(),
+              [&](QDataStream& s) {
+                s << netUuid(pad->getCompSigInstNetSignal());
+              });
+    }
+  }
+
+  // board holes
+  for (const BI_Hole* hole : board.getHoles()) {
+    addItem("hole:" % hole->getUuid().toStr(), QString(),
+            Path::circle(hole->getHole().getDiameter())
+                .translated(hole->getHole().getPosition()),
+            nullptr);
+  }
+
+  // net segments
+  foreach (const BI_NetSegment* netsegment, board.getNetSegments()) {
+    const QString net = netUuid(netsegment->getNetSignal());
+    foreach (const BI_Via* via, netsegment->getVias()) {
+      addItem("via:" % via->getUuid().toStr(), QString(),
+              via->getVia().getSceneOutline(),
+              [&](QDataStream& s) { s << net; });
+    }
+    foreach (const BI_NetLine* netline, netsegment->getNetLines()) {
+      addItem("netline:" % netline->getUuid().toStr(),
+              netline->getLayer().getName(), netline->getSceneOutline(),
+              [&](QDataStream& s) { s << net; });
+    }
+  }
+
+  return items;
+}
+
 /*******************************************************************************
  *  Private Methods
  ******************************************************************************/
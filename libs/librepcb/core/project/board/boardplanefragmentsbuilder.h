@@ -37,6 +37,7 @@ namespace librepcb {
 class BI_FootprintPad;
 class BI_Plane;
 class BI_Via;
+class Board;
 
 /*******************************************************************************
  *  Class BoardPlaneFragmentsBuilder
@@ -47,6 +48,20 @@ class BI_Via;
  */
 class BoardPlaneFragmentsBuilder final {
 public:
+  // Types
+
+  /**
+   * @brief A single object which influences the fragments of planes
+   *
+   * Used to determine which planes need to be rebuilt after modifications,
+   * see ::librepcb::Board::rebuildModifiedPlanes().
+   */
+  struct InputItem {
+    QString layerName;  ///< Affected copper layer, empty for all layers
+    QRectF boundingRect;  ///< Scene bounding rect (pixels)
+    QByteArray data;  ///< Serialized properties to detect modifications
+  };
+
   // Constructors / Destructor
   BoardPlaneFragmentsBuilder() = delete;
   BoardPlaneFragmentsBuilder(const BoardPlaneFragmentsBuilder& other) = delete;
@@ -56,6 +71,37 @@ public:
   // General Methods
   QVector<Path> buildFragments() noexcept;
 
+  // Static Methods
+
+  /**
+   * @brief Calculate a hash over all inputs of all planes of a board
+   *
+   * This includes the planes themselves, the board outline and all
+   * obstacles (pads, holes, vias and traces) together with their net
+   * signals. If the hash did not change, rebuilding the planes leads to
+   * exactly the same fragments, so they can be restored from a cache.
+   * The hash is calculated over the items returned by #collectInputItems().
+   *
+   * @param board   The board containing the planes.
+   *
+   * @return The hash of all plane inputs.
+   */
+  static QByteArray calcInputHash(const Board& board) noexcept;
+
+  /**
+   * @brief Collect all objects which influence the plane fragments
+   *
+   * Comparing the returned items with the items collected at the time the
+   * planes were built yields the regions of the board which were modified
+   * in the meantime.
+   *
+   * @param board   The board containing the planes.
+   *
+   * @return All plane inputs, keyed by a unique identifier of each object.
+   */
+  static QHash<QString, InputItem> collectInputItems(
+      const Board& board) noexcept;
+
   // Operator Overloadings
   BoardPlaneFragmentsBuilder& operator=(const BoardPlaneFragmentsBuilder& rhs) =
       delete;
@@ -25,6 +25,7 @@
 #include "../../../geometry/polygon.h"
 #include "../../../graphics/graphicslayer.h"
 #include "../../../library/pkg/footprint.h"
+#include "../../../library/pkg/footprintpad.h"
 #include "../../../utils/clipperhelpers.h"
 #include "../../../utils/transform.h"
 #include "../board.h"
@@ -36,6 +37,7 @@
 #include "../items/bi_netsegment.h"
 #include "../items/bi_plane.h"
 #include "../items/bi_polygon.h"
+#include "../items/bi_stroketext.h"
 #include "../items/bi_via.h"
 
 #include <QtCore>
@@ -50,7 +52,7 @@ namespace librepcb {
  ******************************************************************************/
 
 BoardClipperPathGenerator::BoardClipperPathGenerator(
-    Board& board, const PositiveLength& maxArcTolerance) noexcept
+    const Board& board, const PositiveLength& maxArcTolerance) noexcept
   : mBoard(board), mMaxArcTolerance(maxArcTolerance), mPaths() {
 }
 
@@ -118,58 +120,82 @@ void BoardClipperPathGenerator::addHoles(const Length& offset) {
 
 void BoardClipperPathGenerator::addCopper(const QString& layerName,
                                           const NetSignal* netsignal) {
-  // polygons
-  foreach (const BI_Polygon* polygon, mBoard.getPolygons()) {
-    if ((polygon->getPolygon().getLayerName() != layerName) ||
-        (netsignal != nullptr)) {
-      continue;
+  forEachCopperItem(layerName, netsignal, [this](const CopperItem& item) {
+    ClipperHelpers::unite(mPaths, item.paths);  // can throw
+  });
+}
+
+void BoardClipperPathGenerator::forEachCopperItem(
+    const tl::optional<QString>& layerName,
+    const tl::optional<const NetSignal*>& netsignal,
+    const CopperItemCallback& callback) const {
+  auto accept = [&layerName, &netsignal](const QString& itemLayer,
+                                         const NetSignal* itemNet) {
+    return ((!layerName) || itemLayer.isEmpty() || (itemLayer == *layerName)) &&
+        ((!netsignal) || (itemNet == *netsignal));
+  };
+  auto addStrokes = [this](ClipperLib::Paths& paths, const Path& path,
+                           const PositiveLength& width) {
+    foreach (const Path& p, path.toOutlineStrokes(width)) {
+      ClipperHelpers::unite(
+          paths, ClipperHelpers::convert(p, mMaxArcTolerance));  // can throw
     }
+  };
+  auto addPolygon = [this, &addStrokes](ClipperLib::Paths& paths,
+                                        const Path& path,
+                                        const UnsignedLength& lineWidth,
+                                        bool filled) {
     // outline
-    if (polygon->getPolygon().getLineWidth() > 0) {
-      QVector<Path> paths = polygon->getPolygon().getPath().toOutlineStrokes(
-          PositiveLength(*polygon->getPolygon().getLineWidth()));
-      foreach (const Path& p, paths) {
-        ClipperHelpers::unite(mPaths,
-                              ClipperHelpers::convert(p, mMaxArcTolerance));
-      }
+    if (lineWidth > 0) {
+      addStrokes(paths, path, PositiveLength(*lineWidth));  // can throw
     }
     // area (only fill closed paths, for consistency with the appearance in the
     // board editor and Gerber output)
-    if (polygon->getPolygon().isFilled() &&
-        polygon->getPolygon().getPath().isClosed()) {
+    if (filled && path.isClosed()) {
       ClipperHelpers::unite(
-          mPaths,
-          ClipperHelpers::convert(polygon->getPolygon().getPath(),
-                                  mMaxArcTolerance));
+          paths, ClipperHelpers::convert(path, mMaxArcTolerance));  // can throw
+    }
+  };
+  auto addText = [&addStrokes](ClipperLib::Paths& paths,
+                               const BI_StrokeText& text) {
+    PositiveLength width(qMax(*text.getText().getStrokeWidth(), Length(1)));
+    Transform transform(text.getText());
+    foreach (const Path& path, transform.map(text.generatePaths())) {
+      addStrokes(paths, path, width);  // can throw
+    }
+  };
+
+  // polygons
+  foreach (const BI_Polygon* polygon, mBoard.getPolygons()) {
+    const Polygon& p = polygon->getPolygon();
+    if (GraphicsLayer::isCopperLayer(*p.getLayerName()) &&
+        accept(*p.getLayerName(), nullptr)) {
+      CopperItem item{*p.getLayerName(), nullptr, {}, {}};
+      addPolygon(item.paths, p.getPath(), p.getLineWidth(), p.isFilled());
+      callback(item);
     }
   }
 
   // stroke texts
   foreach (const BI_StrokeText* text, mBoard.getStrokeTexts()) {
-    if ((text->getText().getLayerName() != layerName) ||
-        (netsignal != nullptr)) {
-      continue;
-    }
-    PositiveLength width(qMax(*text->getText().getStrokeWidth(), Length(1)));
-    Transform transform(text->getText());
-    foreach (Path path, transform.map(text->generatePaths())) {
-      QVector<Path> paths = path.toOutlineStrokes(width);
-      foreach (const Path& p, paths) {
-        ClipperHelpers::unite(mPaths,
-                              ClipperHelpers::convert(p, mMaxArcTolerance));
-      }
+    const QString layer = *text->getText().getLayerName();
+    if (GraphicsLayer::isCopperLayer(layer) && accept(layer, nullptr)) {
+      CopperItem item{layer, nullptr, {}, {}};
+      addText(item.paths, *text);
+      callback(item);
     }
   }
 
   // planes
   foreach (const BI_Plane* plane, mBoard.getPlanes()) {
-    if ((plane->getLayerName() != layerName) ||
-        (&plane->getNetSignal() != netsignal)) {
-      continue;
-    }
-    foreach (const Path& p, plane->getFragments()) {
-      ClipperHelpers::unite(mPaths,
-                            ClipperHelpers::convert(p, mMaxArcTolerance));
+    const QString layer = *plane->getLayerName();
+    if (accept(layer, &plane->getNetSignal())) {
+      foreach (const Path& p, plane->getFragments()) {
+        CopperItem item{layer, &plane->getNetSignal(), {}, {}};
+        ClipperHelpers::unite(item.paths,
+                              ClipperHelpers::convert(p, mMaxArcTolerance));
+        callback(item);
+      }
     }
   }
 
@@ -180,108 +206,86 @@ void BoardClipperPathGenerator::addCopper(const QString& layerName,
 
     // polygons
     for (const Polygon& polygon : device->getLibFootprint().getPolygons()) {
-      GraphicsLayerName polygonLayer = transform.map(polygon.getLayerName());
-      if ((polygonLayer != layerName) || (netsignal != nullptr)) {
-        continue;
-      }
-      Path path = transform.map(polygon.getPath());
-      // outline
-      if (polygon.getLineWidth() > 0) {
-        QVector<Path> paths =
-            path.toOutlineStrokes(PositiveLength(*polygon.getLineWidth()));
-        foreach (const Path& p, paths) {
-          ClipperHelpers::unite(mPaths,
-                                ClipperHelpers::convert(p, mMaxArcTolerance));
-        }
-      }
-      // area (only fill closed paths, for consistency with the appearance in
-      // the board editor and Gerber output)
-      if (polygon.isFilled() && path.isClosed()) {
-        ClipperHelpers::unite(mPaths,
-                              ClipperHelpers::convert(path, mMaxArcTolerance));
+      const QString layer = *transform.map(polygon.getLayerName());
+      if (GraphicsLayer::isCopperLayer(layer) && accept(layer, nullptr)) {
+        CopperItem item{layer, nullptr, {}, {}};
+        addPolygon(item.paths, transform.map(polygon.getPath()),
+                   polygon.getLineWidth(), polygon.isFilled());
+        callback(item);
       }
     }
 
     // circles
     for (const Circle& circle : device->getLibFootprint().getCircles()) {
-      GraphicsLayerName circleLayer = transform.map(circle.getLayerName());
-      if ((circleLayer != layerName) || (netsignal != nullptr)) {
-        continue;
-      }
-      Path path = Path::circle(circle.getDiameter())
-                      .translated(transform.map(circle.getCenter()));
-      // outline
-      if (circle.getLineWidth() > 0) {
-        QVector<Path> paths =
-            path.toOutlineStrokes(PositiveLength(*circle.getLineWidth()));
-        foreach (const Path& p, paths) {
-          ClipperHelpers::unite(mPaths,
-                                ClipperHelpers::convert(p, mMaxArcTolerance));
-        }
-      }
-      // area
-      if (circle.isFilled()) {
-        ClipperHelpers::unite(mPaths,
-                              ClipperHelpers::convert(path, mMaxArcTolerance));
+      const QString layer = *transform.map(circle.getLayerName());
+      if (GraphicsLayer::isCopperLayer(layer) && accept(layer, nullptr)) {
+        CopperItem item{layer, nullptr, {}, {}};
+        Path path = Path::circle(circle.getDiameter())
+                        .translated(transform.map(circle.getCenter()));
+        addPolygon(item.paths, path, circle.getLineWidth(), circle.isFilled());
+        callback(item);
       }
     }
 
     // stroke texts
     foreach (const BI_StrokeText* text, footprint.getStrokeTexts()) {
       // Do *not* mirror layer since it is independent of the device!
-      if ((*text->getText().getLayerName() != layerName) ||
-          (netsignal != nullptr)) {
-        continue;
-      }
-      PositiveLength width(qMax(*text->getText().getStrokeWidth(), Length(1)));
-      Transform transform(text->getText());
-      foreach (Path path, transform.map(text->generatePaths())) {
-        foreach (const Path& p, path.toOutlineStrokes(width)) {
-          ClipperHelpers::unite(mPaths,
-                                ClipperHelpers::convert(p, mMaxArcTolerance));
-        }
+      const QString layer = *text->getText().getLayerName();
+      if (GraphicsLayer::isCopperLayer(layer) && accept(layer, nullptr)) {
+        CopperItem item{layer, nullptr, {}, {}};
+        addText(item.paths, *text);
+        callback(item);
       }
     }
 
     // pads
     foreach (const BI_FootprintPad* pad, footprint.getPads()) {
-      if ((!pad->isOnLayer(layerName)) ||
-          (pad->getCompSigInstNetSignal() != netsignal)) {
-        continue;
+      const bool tht =
+          (pad->getLibPad().getBoardSide() == FootprintPad::BoardSide::THT);
+      const QString layer = tht ? QString() : pad->getLayerName();
+      if (accept(layer, pad->getCompSigInstNetSignal())) {
+        CopperItem item{layer, pad->getCompSigInstNetSignal(), {}, {}};
+        Transform transform(*pad);
+        ClipperHelpers::unite(
+            item.paths,
+            ClipperHelpers::convert(transform.map(pad->getOutline()),
+                                    mMaxArcTolerance));
+        item.anchors.append(pad->getPosition());
+        callback(item);
       }
-      Transform transform(*pad);
-      ClipperHelpers::unite(
-          mPaths,
-          ClipperHelpers::convert(transform.map(pad->getOutline()),
-                                  mMaxArcTolerance));
     }
   }
 
   // net segment items
   foreach (const BI_NetSegment* netsegment, mBoard.getNetSegments()) {
-    if (netsegment->getNetSignal() != netsignal) {
+    if (netsignal && (netsegment->getNetSignal() != *netsignal)) {
       continue;
     }
 
     // vias
     foreach (const BI_Via* via, netsegment->getVias()) {
-      if (!via->isOnLayer(layerName)) {
-        continue;
-      }
+      CopperItem item{QString(), netsegment->getNetSignal(), {}, {}};
       ClipperHelpers::unite(
-          mPaths,
+          item.paths,
           ClipperHelpers::convert(via->getVia().getSceneOutline(),
                                   mMaxArcTolerance));
+      item.anchors.append(via->getPosition());
+      callback(item);
     }
 
     // netlines
     foreach (const BI_NetLine* netline, netsegment->getNetLines()) {
-      if (&netline->getLayer().getName() != layerName) {
-        continue;
+      const QString layer = netline->getLayer().getName();
+      if (accept(layer, netsegment->getNetSignal())) {
+        CopperItem item{layer, netsegment->getNetSignal(), {}, {}};
+        ClipperHelpers::unite(
+            item.paths,
+            ClipperHelpers::convert(netline->getSceneOutline(),
+                                    mMaxArcTolerance));
+        item.anchors.append(netline->getStartPoint().getPosition());
+        item.anchors.append(netline->getEndPoint().getPosition());
+        callback(item);
       }
-      ClipperHelpers::unite(mPaths,
-                            ClipperHelpers::convert(netline->getSceneOutline(),
-                                                    mMaxArcTolerance));
     }
   }
 }
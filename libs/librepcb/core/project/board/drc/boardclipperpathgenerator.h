@@ -24,11 +24,15 @@
  *  Includes
  ******************************************************************************/
 #include "../../../types/length.h"
+#include "../../../types/point.h"
 
+#include <optional.hpp>
 #include <polyclipping/clipper.hpp>
 
 #include <QtCore>
 
+#include <functional>
+
 /*******************************************************************************
  *  Namespace / Forward Declarations
  ******************************************************************************/
@@ -48,9 +52,28 @@ class NetSignal;
  */
 class BoardClipperPathGenerator final {
 public:
+  // Types
+
+  /**
+   * @brief A single copper object of the board
+   *
+   * See #forEachCopperItem().
+   */
+  struct CopperItem {
+    /// Name of the copper layer, or an empty string if the item is located on
+    /// all copper layers (e.g. vias and THT pads)
+    QString layerName;
+    const NetSignal* netsignal;  ///< `nullptr` for unconnected copper
+    ClipperLib::Paths paths;  ///< The copper area
+    /// Points which need to be connected with the rest of the net (e.g. the
+    /// center of a pad, or the end points of a trace), if any
+    QVector<Point> anchors;
+  };
+  typedef std::function<void(const CopperItem&)> CopperItemCallback;
+
   // Constructors / Destructor
   explicit BoardClipperPathGenerator(
-      Board& board, const PositiveLength& maxArcTolerance) noexcept;
+      const Board& board, const PositiveLength& maxArcTolerance) noexcept;
   ~BoardClipperPathGenerator() noexcept;
 
   // Getters
@@ -61,8 +84,27 @@ public:
   void addHoles(const Length& offset);
   void addCopper(const QString& layerName, const NetSignal* netsignal);
 
+  /**
+   * @brief Enumerate the copper objects of the board
+   *
+   * This is the item enumeration behind #addCopper(), so all consumers of
+   * the board copper (e.g. clearance checks and connectivity) see exactly
+   * the same objects. The paths of filtered out items are not generated.
+   *
+   * @param layerName   If set, only items on this layer (including items on
+   *                    all layers) are reported.
+   * @param netsignal   If set, only items of this net are reported
+   *                    (`nullptr` for unconnected copper).
+   * @param callback    Called for each copper item.
+   *
+   * @throw Exception if a polygon operation failed
+   */
+  void forEachCopperItem(const tl::optional<QString>& layerName,
+                         const tl::optional<const NetSignal*>& netsignal,
+                         const CopperItemCallback& callback) const;
+
 private:  // Data
-  Board& mBoard;
+  const Board& mBoard;
   PositiveLength mMaxArcTolerance;
   ClipperLib::Paths mPaths;
 };
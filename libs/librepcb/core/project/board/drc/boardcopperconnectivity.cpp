@@ -0,0 +1,165 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "boardcopperconnectivity.h"
+
+#include "../../../graphics/graphicslayer.h"
+#include "../../../utils/clipperhelpers.h"
+#include "../board.h"
+#include "../boardlayerstack.h"
+#include "boardclipperpathgenerator.h"
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+BoardCopperConnectivity::BoardCopperConnectivity(
+    const Board& board, const PositiveLength& maxArcTolerance) noexcept
+  : mBoard(board),
+    mMaxArcTolerance(maxArcTolerance),
+    mBuilder(),
+    mNetSignals(),
+    mNetSignalIds(),
+    mItemAnchors(),
+    mNetSignalItems() {
+}
+
+BoardCopperConnectivity::~BoardCopperConnectivity() noexcept {
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+void BoardCopperConnectivity::build() {
+  addItems();  // can throw
+  buildClusters();  // can throw
+}
+
+void BoardCopperConnectivity::addItems() {
+  QSet<QString> layers;
+  foreach (const GraphicsLayer* layer, mBoard.getLayerStack().getAllLayers()) {
+    if (layer->isCopperLayer() && layer->isEnabled()) {
+      layers.insert(layer->getName());
+    }
+  }
+
+  // Use the same items as the clearance check to get consistent results.
+  BoardClipperPathGenerator gen(mBoard, mMaxArcTolerance);
+  gen.forEachCopperItem(
+      tl::nullopt, tl::nullopt,
+      [this, &layers](const BoardClipperPathGenerator::CopperItem& item) {
+        if (item.layerName.isEmpty() || layers.contains(item.layerName)) {
+          addItem(item.netsignal, item.layerName, item.paths, item.anchors);
+        }
+      });  // can throw
+}
+
+void BoardCopperConnectivity::buildClusters() {
+  mBuilder.build();  // can throw
+}
+
+AirWiresBuilder::AirWires BoardCopperConnectivity::getMissingConnections(
+    const NetSignal& netsignal) const noexcept {
+  AirWiresBuilder builder;
+  QHash<int, int> clusterPoints;  // Cluster index -> ID of last added point
+  foreach (int item, mNetSignalItems.value(&netsignal)) {
+    const int cluster = mBuilder.getClusterOfItem(item);
+    foreach (const Point& anchor, mItemAnchors.at(item)) {
+      const int id = builder.addPoint(anchor);
+      auto it = clusterPoints.find(cluster);
+      if (it != clusterPoints.end()) {
+        builder.addEdge(it.value(), id);
+        it.value() = id;
+      } else {
+        clusterPoints.insert(cluster, id);
+      }
+    }
+  }
+  return builder.buildAirWires();
+}
+
+QVector<BoardCopperConnectivity::ShortCircuit>
+    BoardCopperConnectivity::getShortCircuits() const {
+  QVector<ShortCircuit> shortCircuits;
+  foreach (const auto& sc, mBuilder.getShortCircuits()) {
+    ClipperLib::Paths location;
+    foreach (const auto& overlap, sc.overlaps) {
+      std::unique_ptr<ClipperLib::PolyTree> intersections =
+          ClipperHelpers::intersect(
+              mBuilder.getItemPaths(overlap.first),
+              mBuilder.getItemPaths(overlap.second));  // can throw
+      ClipperHelpers::unite(
+          location, ClipperHelpers::flattenTree(*intersections));  // can throw
+    }
+    shortCircuits.append(ShortCircuit{mNetSignals.at(sc.net1),
+                                      mNetSignals.at(sc.net2),
+                                      ClipperHelpers::convert(location)});
+  }
+  return shortCircuits;
+}
+
+QVector<std::pair<const NetSignal*, const NetSignal*>>
+    BoardCopperConnectivity::getShortCircuitNets() const noexcept {
+  QVector<std::pair<const NetSignal*, const NetSignal*>> nets;
+  foreach (const auto& sc, mBuilder.getShortCircuits()) {
+    nets.append(
+        std::make_pair(mNetSignals.at(sc.net1), mNetSignals.at(sc.net2)));
+  }
+  return nets;
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void BoardCopperConnectivity::addItem(const NetSignal* netsignal,
+                                      const QString& layerName,
+                                      const ClipperLib::Paths& paths,
+                                      const QVector<Point>& anchors) {
+  int net = -1;
+  if (netsignal) {
+    auto it = mNetSignalIds.find(netsignal);
+    if (it == mNetSignalIds.end()) {
+      it = mNetSignalIds.insert(netsignal, mNetSignals.count());
+      mNetSignals.append(netsignal);
+    }
+    net = it.value();
+  }
+  const int id = mBuilder.addItem(layerName, paths, net);
+  Q_ASSERT(id == mItemAnchors.count());
+  mItemAnchors.append(anchors);
+  mNetSignalItems[netsignal].append(id);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
@@ -0,0 +1,181 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_CORE_BOARDCOPPERCONNECTIVITY_H
+#define LIBREPCB_CORE_BOARDCOPPERCONNECTIVITY_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../../../algorithm/airwiresbuilder.h"
+#include "../../../algorithm/copperconnectivitybuilder.h"
+#include "../../../geometry/path.h"
+#include "../../../types/length.h"
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+class Board;
+class NetSignal;
+
+/*******************************************************************************
+ *  Class BoardCopperConnectivity
+ ******************************************************************************/
+
+/**
+ * @brief Physical copper connectivity of a ::librepcb::Board
+ *
+ * In contrast to the air wires (which are derived from the logical topology
+ * of the net segments), this class determines which copper objects actually
+ * touch each other. All copper objects on enabled copper layers (as
+ * enumerated by ::librepcb::BoardClipperPathGenerator::forEachCopperItem())
+ * are passed to a ::librepcb::CopperConnectivityBuilder, where vias and THT
+ * pads connect the copper layers.
+ */
+class BoardCopperConnectivity final {
+public:
+  // Types
+  struct ShortCircuit {
+    const NetSignal* netSignal1;  ///< Never `nullptr`
+    const NetSignal* netSignal2;  ///< Never `nullptr`
+    QVector<Path> location;  ///< Overlapping area of the shorted copper
+  };
+
+  // Constructors / Destructor
+  BoardCopperConnectivity() = delete;
+  BoardCopperConnectivity(const BoardCopperConnectivity& other) = delete;
+  BoardCopperConnectivity(const Board& board,
+                          const PositiveLength& maxArcTolerance) noexcept;
+  ~BoardCopperConnectivity() noexcept;
+
+  // Getters
+  const CopperConnectivityBuilder& getBuilder() const noexcept {
+    return mBuilder;
+  }
+
+  // General Methods
+
+  /**
+   * @brief Collect all copper objects of the board and build the clusters
+   *
+   * Same as #addItems() followed by #buildClusters().
+   *
+   * @throw Exception if a polygon operation failed
+   */
+  void build();
+
+  /**
+   * @brief Collect all copper objects of the board
+   *
+   * Must be called in the thread of the board.
+   *
+   * @throw Exception if a polygon operation failed
+   */
+  void addItems();
+
+  /**
+   * @brief Build the clusters of the collected copper objects
+   *
+   * Does not access the board anymore, so this may be called in a worker
+   * thread as long as the board is not accessed through this object
+   * concurrently.
+   *
+   * @throw Exception if a polygon operation failed
+   */
+  void buildClusters();
+
+  /**
+   * @brief Determine the missing connections of a net
+   *
+   * Each cluster of physically connected copper of the net is treated as
+   * one node, and the shortest connections required to join all of them
+   * are returned (like air wires, but based on the real copper).
+   *
+   * @param netsignal   The net signal to check.
+   *
+   * @return Start and end points of the missing connections
+   */
+  AirWiresBuilder::AirWires getMissingConnections(
+      const NetSignal& netsignal) const noexcept;
+
+  /**
+   * @brief Determine the short circuits between different nets
+   *
+   * Every overlap between copper objects of two different nets is reported
+   * as a separate short circuit, so multiple shorts within the same cluster
+   * are all found. Unconnected copper (e.g. a polygon without net) which
+   * touches objects of different nets is reported as a short circuit
+   * between these nets, located at the overlaps with the unconnected copper.
+   * See ::librepcb::CopperConnectivityBuilder::getShortCircuits() for
+   * details.
+   *
+   * @return All found short circuits
+   *
+   * @throw Exception if a polygon operation failed
+   */
+  QVector<ShortCircuit> getShortCircuits() const;
+
+  /**
+   * @brief Determine the net signals of all short circuits
+   *
+   * Same as #getShortCircuits(), but without the expensive calculation of
+   * the locations.
+   *
+   * @return Both net signals of each short circuit (never `nullptr`)
+   */
+  QVector<std::pair<const NetSignal*, const NetSignal*>> getShortCircuitNets()
+      const noexcept;
+
+  // Operator Overloadings
+  BoardCopperConnectivity& operator=(const BoardCopperConnectivity& rhs) =
+      delete;
+
+private:  // Methods
+  void addItem(const NetSignal* netsignal, const QString& layerName,
+               const ClipperLib::Paths& paths, const QVector<Point>& anchors);
+
+private:  // Data
+  const Board& mBoard;
+  PositiveLength mMaxArcTolerance;
+  CopperConnectivityBuilder mBuilder;
+
+  /// Net signal of each net ID passed to the builder
+  QVector<const NetSignal*> mNetSignals;
+
+  /// Net ID of each net signal, i.e. the inverse of #mNetSignals
+  QHash<const NetSignal*, int> mNetSignalIds;
+
+  /// Points of each item which need to be connected with the rest of the net
+  QVector<QVector<Point>> mItemAnchors;
+
+  /// IDs of all items per net signal
+  QHash<const NetSignal*, QVector<int>> mNetSignalItems;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif
@@ -0,0 +1,119 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "boardcoppergeometrycache.h"
+
+#include "../board.h"
+#include "boardclipperpathgenerator.h"
+
+#include <QtCore>
+
+#include <algorithm>
+#include <limits>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+BoardCopperGeometryCache::BoardCopperGeometryCache(Board& board) noexcept
+  : mBoard(board), mEntries() {
+}
+
+BoardCopperGeometryCache::~BoardCopperGeometryCache() noexcept {
+}
+
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+std::shared_ptr<const BoardCopperGeometryCache::Entry>
+    BoardCopperGeometryCache::get(const QString& layerName,
+                                  const NetSignal* netsignal) const {
+  QHash<QString, std::shared_ptr<const Entry>>& layers = mEntries[netsignal];
+  auto it = layers.constFind(layerName);
+  if (it != layers.constEnd()) {
+    return *it;
+  }
+
+  BoardClipperPathGenerator gen(mBoard, maxArcTolerance());
+  gen.addCopper(layerName, netsignal);  // can throw
+  std::shared_ptr<Entry> entry = std::make_shared<Entry>();
+  entry->paths = gen.getPaths();
+  entry->isEmpty = true;
+  entry->boundingBox.left = std::numeric_limits<ClipperLib::cInt>::max();
+  entry->boundingBox.top = std::numeric_limits<ClipperLib::cInt>::max();
+  entry->boundingBox.right = std::numeric_limits<ClipperLib::cInt>::min();
+  entry->boundingBox.bottom = std::numeric_limits<ClipperLib::cInt>::min();
+  for (const ClipperLib::Path& path : entry->paths) {
+    for (const ClipperLib::IntPoint& p : path) {
+      entry->boundingBox.left = std::min(entry->boundingBox.left, p.X);
+      entry->boundingBox.top = std::min(entry->boundingBox.top, p.Y);
+      entry->boundingBox.right = std::max(entry->boundingBox.right, p.X);
+      entry->boundingBox.bottom = std::max(entry->boundingBox.bottom, p.Y);
+      entry->isEmpty = false;
+    }
+  }
+  if (entry->isEmpty) {
+    entry->boundingBox = ClipperLib::IntRect{0, 0, 0, 0};
+  }
+  layers.insert(layerName, entry);
+  return entry;
+}
+
+int BoardCopperGeometryCache::getCachedEntriesCount() const noexcept {
+  int count = 0;
+  foreach (const auto& layers, mEntries) { count += layers.count(); }
+  return count;
+}
+
+bool BoardCopperGeometryCache::boundingBoxesNear(
+    const ClipperLib::IntRect& a, const ClipperLib::IntRect& b,
+    const Length& distance) noexcept {
+  const ClipperLib::cInt d = distance.toNm();
+  return (a.left - d <= b.right) && (b.left - d <= a.right) &&
+      (a.top - d <= b.bottom) && (b.top - d <= a.bottom);
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+void BoardCopperGeometryCache::invalidate(const NetSignal* netsignal) noexcept {
+  mEntries.remove(netsignal);
+  mBoard.scheduleShortCircuitsCheck();
+}
+
+void BoardCopperGeometryCache::invalidateAll() noexcept {
+  mEntries.clear();
+  mBoard.scheduleShortCircuitsCheck();
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
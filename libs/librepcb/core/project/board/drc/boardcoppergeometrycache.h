@@ -0,0 +1,156 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_CORE_BOARDCOPPERGEOMETRYCACHE_H
+#define LIBREPCB_CORE_BOARDCOPPERGEOMETRYCACHE_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../../../types/length.h"
+
+#include <polyclipping/clipper.hpp>
+
+#include <QtCore>
+
+#include <memory>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+class Board;
+class NetSignal;
+
+/*******************************************************************************
+ *  Class BoardCopperGeometryCache
+ ******************************************************************************/
+
+/**
+ * @brief Lazily computed, per-net copper geometry of a ::librepcb::Board
+ *
+ * For every pair of copper layer and net signal, the united copper area (as
+ * generated by ::librepcb::BoardClipperPathGenerator::addCopper()) is computed
+ * on first access and kept until the board items of that net are modified.
+ * The board items call #invalidate() from their setters, so consecutive
+ * design rule checks only need to recompute the geometry of the nets which
+ * were actually modified in between.
+ *
+ * Unconnected copper objects (polygons, stroke texts, pads without net etc.)
+ * are stored under the `nullptr` net signal.
+ *
+ * Since every copper modification passes through #invalidate(), it also
+ * schedules the board's short circuit check (see
+ * ::librepcb::Board::scheduleShortCircuitsCheck()).
+ *
+ * @note The cache is not thread-safe, it must only be used from the thread
+ *       the board lives in.
+ */
+class BoardCopperGeometryCache final {
+public:
+  /**
+   * @brief The cached geometry of one net on one layer
+   */
+  struct Entry {
+    ClipperLib::Paths paths;  ///< United copper area
+    ClipperLib::IntRect boundingBox;  ///< Bounding box of #paths
+    bool isEmpty;  ///< Whether #paths contains no points at all
+  };
+
+  // Constructors / Destructor
+  BoardCopperGeometryCache() = delete;
+  BoardCopperGeometryCache(const BoardCopperGeometryCache& other) = delete;
+  explicit BoardCopperGeometryCache(Board& board) noexcept;
+  ~BoardCopperGeometryCache() noexcept;
+
+  // Getters
+
+  /**
+   * @brief Get the copper geometry of a net on a layer
+   *
+   * @param layerName   Name of the copper layer.
+   * @param netsignal   The net signal, or `nullptr` for unconnected copper.
+   *
+   * @return The (possibly just computed) geometry. The returned pointer
+   *         stays valid even if the entry gets invalidated afterwards.
+   */
+  std::shared_ptr<const Entry> get(const QString& layerName,
+                                   const NetSignal* netsignal) const;
+
+  /**
+   * @brief Same as #get(), but returns only the paths
+   *
+   * @attention The returned reference becomes dangling as soon as the
+   *            entry gets invalidated, thus it must not be stored.
+   */
+  const ClipperLib::Paths& getPaths(const QString& layerName,
+                                    const NetSignal* netsignal) const {
+    return get(layerName, netsignal)->paths;  // can throw
+  }
+  int getCachedEntriesCount() const noexcept;
+
+  /**
+   * @brief Returns the maximum allowed arc tolerance when flattening arcs
+   */
+  static PositiveLength maxArcTolerance() noexcept {
+    return PositiveLength(5000);
+  }
+
+  /**
+   * @brief Check whether two bounding boxes are closer than a given distance
+   *
+   * @param a         First bounding box.
+   * @param b         Second bounding box.
+   * @param distance  Minimum gap between the boxes.
+   *
+   * @return False if the boxes are guaranteed to be at least `distance`
+   *         apart, true otherwise.
+   */
+  static bool boundingBoxesNear(const ClipperLib::IntRect& a,
+                                const ClipperLib::IntRect& b,
+                                const Length& distance) noexcept;
+
+  // General Methods
+
+  /**
+   * @brief Discard the cached geometry of a net on all layers
+   *
+   * @param netsignal   The net signal, or `nullptr` for unconnected copper.
+   */
+  void invalidate(const NetSignal* netsignal) noexcept;
+  void invalidateAll() noexcept;
+
+  // Operator Overloadings
+  BoardCopperGeometryCache& operator=(const BoardCopperGeometryCache& rhs) =
+      delete;
+
+private:  // Data
+  Board& mBoard;
+  mutable QHash<const NetSignal*, QHash<QString, std::shared_ptr<const Entry>>>
+      mEntries;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif
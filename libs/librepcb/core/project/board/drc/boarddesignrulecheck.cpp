@@ -26,6 +26,7 @@
 #include "../../../geometry/stroketext.h"
 #include "../../../library/pkg/footprint.h"
 #include "../../../library/pkg/footprintpad.h"
+#include "../../../tracer.h"
 #include "../../../utils/clipperhelpers.h"
 #include "../../../utils/toolbox.h"
 #include "../../../utils/transform.h"
@@ -35,7 +36,6 @@
 #include "../../project.h"
 #include "../board.h"
 #include "../boardlayerstack.h"
-#include "../items/bi_airwire.h"
 #include "../items/bi_device.h"
 #include "../items/bi_footprint.h"
 #include "../items/bi_footprintpad.h"
@@ -46,6 +46,7 @@
 #include "../items/bi_stroketext.h"
 #include "../items/bi_via.h"
 #include "boardclipperpathgenerator.h"
+#include "boardcopperconnectivity.h"
 
 #include <QtCore>
 
@@ -64,7 +65,8 @@ BoardDesignRuleCheck::BoardDesignRuleCheck(Board& board, const Options& options,
     mBoard(board),
     mOptions(options),
     mProgressStatus(),
-    mMessages() {
+    mMessages(),
+    mCopperConnectivity() {
 }
 
 BoardDesignRuleCheck::~BoardDesignRuleCheck() noexcept {
@@ -75,11 +77,13 @@ BoardDesignRuleCheck::~BoardDesignRuleCheck() noexcept {
  ******************************************************************************/
 
 void BoardDesignRuleCheck::execute() {
+  const TraceZone traceZone("BoardDesignRuleCheck::execute");
   emit started();
   emit progressPercent(5);
 
   mProgressStatus.clear();
   mMessages.clear();
+  mCopperConnectivity.reset();
 
   if (mOptions.rebuildPlanes) {
     rebuildPlanes(5, 15);
@@ -108,10 +112,14 @@ void BoardDesignRuleCheck::execute() {
   if (mOptions.checkMissingConnections) {
     checkForMissingConnections(88, 90);
   }
+  if (mOptions.checkShortCircuits) {
+    checkForShortCircuits(90, 92);
+  }
 
   emitStatus(
       tr("Finished with %1 message(s)!", "Count of messages", mMessages.count())
           .arg(mMessages.count()));
+  mCopperConnectivity.reset();
   emit progressPercent(100);
   emit finished();
 }
@@ -121,26 +129,54 @@ void BoardDesignRuleCheck::execute() {
  ******************************************************************************/
 
 void BoardDesignRuleCheck::rebuildPlanes(int progressStart, int progressEnd) {
+  const TraceZone traceZone("BoardDesignRuleCheck::rebuildPlanes");
   Q_UNUSED(progressStart);
   emitStatus(tr("Rebuild planes..."));
-  mBoard.rebuildAllPlanes();
+  mBoard.rebuildModifiedPlanes();
   emit progressPercent(progressEnd);
 }
 
 void BoardDesignRuleCheck::checkForMissingConnections(int progressStart,
                                                       int progressEnd) {
+  const TraceZone traceZone("BoardDesignRuleCheck::checkForMissingConnections");
   Q_UNUSED(progressStart);
   emitStatus(tr("Check for missing connections..."));
 
-  // No check based on copper paths implemented yet -> return existing airwires
-  // instead.
-  mBoard.forceAirWiresRebuild();
-  foreach (const BI_AirWire* airwire, mBoard.getAirWires()) {
-    QString msg = tr("Missing connection: '%1'", "Placeholder is net name")
-                      .arg(*airwire->getNetSignal().getName());
-    Path location = Path::obround(airwire->getP1(), airwire->getP2(),
-                                  PositiveLength(50000));
-    emitMessage(BoardDesignRuleCheckMessage(msg, location));
+  // Use the real copper connectivity instead of relying on the air wires,
+  // which only reflect the logical topology of the net segments.
+  const BoardCopperConnectivity& connectivity =
+      getCopperConnectivity();  // can throw
+  foreach (const NetSignal* netsignal,
+           mBoard.getProject().getCircuit().getNetSignals()) {
+    foreach (const auto& connection,
+             connectivity.getMissingConnections(*netsignal)) {
+      QString msg = tr("Missing connection: '%1'", "Placeholder is net name")
+                        .arg(*netsignal->getName());
+      Path location = Path::obround(connection.first, connection.second,
+                                    PositiveLength(50000));
+      emitMessage(BoardDesignRuleCheckMessage(msg, location));
+    }
+  }
+
+  emit progressPercent(progressEnd);
+}
+
+void BoardDesignRuleCheck::checkForShortCircuits(int progressStart,
+                                                 int progressEnd) {
+  const TraceZone traceZone("BoardDesignRuleCheck::checkForShortCircuits");
+  Q_UNUSED(progressStart);
+  emitStatus(tr("Check for short circuits..."));
+
+  const QVector<BoardCopperConnectivity::ShortCircuit> shortCircuits =
+      getCopperConnectivity().getShortCircuits();  // can throw
+  foreach (const auto& shortCircuit, shortCircuits) {
+    QString msg =
+        tr("Short circuit: '%1' <-> '%2'", "Placeholders are net names")
+            .arg(*shortCircuit.netSignal1->getName(),
+                 *shortCircuit.netSignal2->getName());
+    foreach (const Path& location, shortCircuit.location) {
+      emitMessage(BoardDesignRuleCheckMessage(msg, location));
+    }
   }
 
   emit progressPercent(progressEnd);
@@ -148,6 +184,7 @@ void BoardDesignRuleCheck::checkForMissingConnections(int progressStart,
 
 void BoardDesignRuleCheck::checkCopperBoardClearances(int progressStart,
                                                       int progressEnd) {
+  const TraceZone traceZone("BoardDesignRuleCheck::checkCopperBoardClearances");
   emitStatus(tr("Check board clearances..."));
 
   qreal progressSpan = progressEnd - progressStart;
@@ -205,12 +242,15 @@ void BoardDesignRuleCheck::checkCopperBoardClearances(int progressStart,
 
 void BoardDesignRuleCheck::checkCopperCopperClearances(int progressStart,
                                                        int progressEnd) {
+  const TraceZone traceZone(
+      "BoardDesignRuleCheck::checkCopperCopperClearances");
   emitStatus(tr("Check copper clearances..."));
 
   qreal progressSpan = progressEnd - progressStart;
   QList<NetSignal*> netsignals =
       mBoard.getProject().getCircuit().getNetSignals().values();
   netsignals.append(nullptr);  // also check unconnected copper objects
+  BoardCopperGeometryCache& cache = mBoard.getCopperGeometryCache();
 
   auto layers = mBoard.getLayerStack().getAllLayers();
   for (int layerIndex = 0; layerIndex < layers.count(); ++layerIndex) {
@@ -218,13 +258,25 @@ void BoardDesignRuleCheck::checkCopperCopperClearances(int progressStart,
     if ((!layer->isCopperLayer()) || (!layer->isEnabled())) {
       continue;
     }
+    // Fetch the (cached) geometry of all nets once, to allow skipping net
+    // pairs whose bounding boxes are too far apart to violate the clearance.
+    QVector<std::shared_ptr<const BoardCopperGeometryCache::Entry>> entries;
+    for (const NetSignal* netsignal : netsignals) {
+      entries.append(cache.get(layer->getName(), netsignal));  // can throw
+    }
     for (int i = 0; i < netsignals.count(); ++i) {
-      ClipperLib::Paths paths1 = getCopperPaths(layer, netsignals[i]);
+      ClipperLib::Paths paths1 = entries[i]->paths;
       ClipperHelpers::offset(
           paths1, (*mOptions.minCopperCopperClearance - *maxArcTolerance()) / 2,
           maxArcTolerance());
       for (int k = i + 1; k < netsignals.count(); ++k) {
-        ClipperLib::Paths paths2 = getCopperPaths(layer, netsignals[k]);
+        if (entries[i]->isEmpty || entries[k]->isEmpty ||
+            (!BoardCopperGeometryCache::boundingBoxesNear(
+                entries[i]->boundingBox, entries[k]->boundingBox,
+                *mOptions.minCopperCopperClearance))) {
+          continue;
+        }
+        ClipperLib::Paths paths2 = entries[k]->paths;
         ClipperHelpers::offset(
             paths2,
             (*mOptions.minCopperCopperClearance - *maxArcTolerance()) / 2,
@@ -252,6 +304,7 @@ void BoardDesignRuleCheck::checkCopperCopperClearances(int progressStart,
 
 void BoardDesignRuleCheck::checkCourtyardClearances(int progressStart,
                                                     int progressEnd) {
+  const TraceZone traceZone("BoardDesignRuleCheck::checkCourtyardClearances");
   Q_UNUSED(progressStart);
   emitStatus(tr("Check courtyard clearances..."));
 
@@ -297,6 +350,7 @@ void BoardDesignRuleCheck::checkCourtyardClearances(int progressStart,
 
 void BoardDesignRuleCheck::checkMinimumCopperWidth(int progressStart,
                                                    int progressEnd) {
+  const TraceZone traceZone("BoardDesignRuleCheck::checkMinimumCopperWidth");
   Q_UNUSED(progressStart);
   emitStatus(tr("Check minimum copper width..."));
 
@@ -392,6 +446,7 @@ void BoardDesignRuleCheck::checkMinimumCopperWidth(int progressStart,
 
 void BoardDesignRuleCheck::checkMinimumPthRestring(int progressStart,
                                                    int progressEnd) {
+  const TraceZone traceZone("BoardDesignRuleCheck::checkMinimumPthRestring");
   Q_UNUSED(progressStart);
   emitStatus(tr("Check minimum PTH restrings..."));
 
@@ -441,6 +496,8 @@ void BoardDesignRuleCheck::checkMinimumPthRestring(int progressStart,
 
 void BoardDesignRuleCheck::checkMinimumPthDrillDiameter(int progressStart,
                                                         int progressEnd) {
+  const TraceZone traceZone(
+      "BoardDesignRuleCheck::checkMinimumPthDrillDiameter");
   Q_UNUSED(progressStart);
   emitStatus(tr("Check minimum PTH drill diameters..."));
 
@@ -485,6 +542,8 @@ void BoardDesignRuleCheck::checkMinimumPthDrillDiameter(int progressStart,
 
 void BoardDesignRuleCheck::checkMinimumNpthDrillDiameter(int progressStart,
                                                          int progressEnd) {
+  const TraceZone traceZone(
+      "BoardDesignRuleCheck::checkMinimumNpthDrillDiameter");
   Q_UNUSED(progressStart);
   emitStatus(tr("Check minimum NPTH drill diameters..."));
 
@@ -517,14 +576,20 @@ void BoardDesignRuleCheck::checkMinimumNpthDrillDiameter(int progressStart,
   emit progressPercent(progressEnd);
 }
 
+const BoardCopperConnectivity& BoardDesignRuleCheck::getCopperConnectivity() {
+  if (!mCopperConnectivity) {
+    std::unique_ptr<BoardCopperConnectivity> connectivity(
+        new BoardCopperConnectivity(mBoard, maxArcTolerance()));
+    connectivity->build();  // can throw
+    mCopperConnectivity = std::move(connectivity);
+  }
+  return *mCopperConnectivity;
+}
+
 const ClipperLib::Paths& BoardDesignRuleCheck::getCopperPaths(
     const GraphicsLayer* layer, const NetSignal* netsignal) {
-  if (!mCachedPaths[layer].contains(netsignal)) {
-    BoardClipperPathGenerator gen(mBoard, maxArcTolerance());
-    gen.addCopper(layer->getName(), netsignal);
-    mCachedPaths[layer][netsignal] = gen.getPaths();
-  }
-  return mCachedPaths[layer][netsignal];
+  return mBoard.getCopperGeometryCache().getPaths(layer->getName(),
+                                                  netsignal);  // can throw
 }
 
 ClipperLib::Paths BoardDesignRuleCheck::getDeviceCourtyardPaths(
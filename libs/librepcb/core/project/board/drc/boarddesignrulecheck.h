@@ -23,12 +23,15 @@
 /*******************************************************************************
  *  Includes
  ******************************************************************************/
+#include "boardcoppergeometrycache.h"
 #include "boarddesignrulecheckmessage.h"
 
 #include <polyclipping/clipper.hpp>
 
 #include <QtCore>
 
+#include <memory>
+
 /*******************************************************************************
  *  Namespace / Forward Declarations
  ******************************************************************************/
@@ -36,6 +39,7 @@ namespace librepcb {
 
 class BI_Device;
 class Board;
+class BoardCopperConnectivity;
 class GraphicsLayer;
 class NetSignal;
 
@@ -80,6 +84,8 @@ public:
 
     bool checkMissingConnections;
 
+    bool checkShortCircuits;
+
     Options()
       : rebuildPlanes(true),
         checkCopperWidth(true),
@@ -98,7 +104,8 @@ public:
         minPthDrillDiameter(250000),  // 250um
         checkCourtyardClearance(true),
         courtyardOffset(0),  // 0um
-        checkMissingConnections(true) {}
+        checkMissingConnections(true),
+        checkShortCircuits(true) {}
   };
 
   // Constructors / Destructor
@@ -127,6 +134,7 @@ signals:
 private:  // Methods
   void rebuildPlanes(int progressStart, int progressEnd);
   void checkForMissingConnections(int progressStart, int progressEnd);
+  void checkForShortCircuits(int progressStart, int progressEnd);
   void checkCopperBoardClearances(int progressStart, int progressEnd);
   void checkCopperCopperClearances(int progressStart, int progressEnd);
   void checkCourtyardClearances(int progressStart, int progressEnd);
@@ -134,6 +142,7 @@ private:  // Methods
   void checkMinimumPthRestring(int progressStart, int progressEnd);
   void checkMinimumPthDrillDiameter(int progressStart, int progressEnd);
   void checkMinimumNpthDrillDiameter(int progressStart, int progressEnd);
+  const BoardCopperConnectivity& getCopperConnectivity();
   const ClipperLib::Paths& getCopperPaths(const GraphicsLayer* layer,
                                           const NetSignal* netsignal);
   ClipperLib::Paths getDeviceCourtyardPaths(const BI_Device& device,
@@ -146,7 +155,7 @@ private:  // Methods
    * Returns the maximum allowed arc tolerance when flattening arcs.
    */
   static PositiveLength maxArcTolerance() noexcept {
-    return PositiveLength(5000);
+    return BoardCopperGeometryCache::maxArcTolerance();
   }
 
 private:  // Data
@@ -154,8 +163,9 @@ private:  // Data
   Options mOptions;
   QStringList mProgressStatus;
   QList<BoardDesignRuleCheckMessage> mMessages;
-  QHash<const GraphicsLayer*, QHash<const NetSignal*, ClipperLib::Paths>>
-      mCachedPaths;
+
+  /// Built on demand by #getCopperConnectivity(), reset by #execute()
+  std::unique_ptr<BoardCopperConnectivity> mCopperConnectivity;
 };
 
 /*******************************************************************************
@@ -137,51 +137,69 @@ void BGI_FootprintPad::updateCacheAndRepaint() noexcept {
 void BGI_FootprintPad::paint(QPainter* painter,
                              const QStyleOptionGraphicsItem* option,
                              QWidget* widget) {
-  Q_UNUSED(option);
   Q_UNUSED(widget);
 
   const NetSignal* netsignal = mPad.getCompSigInstNetSignal();
   bool highlight =
       mPad.isSelected() || (netsignal && netsignal->isHighlighted());
 
+  // When zoomed out, pads are only a few pixels large. Then their exact shape
+  // is not visible anyway, so draw simple rectangles (much faster than paths)
+  // and omit the (unreadable) pad text.
+  const qreal lod =
+      option->levelOfDetailFromTransform(painter->worldTransform());
+  const QRectF copperRect = mCopper.boundingRect();
+  const bool drawSimplified =
+      (qMax(copperRect.width(), copperRect.height()) * lod) < 3;
+  const bool drawText = (mFont.pixelSize() * lod) > 4;
+  auto drawArea = [&](const QPainterPath& path) {
+    if (drawSimplified) {
+      painter->drawRect(path.boundingRect());
+    } else {
+      painter->drawPath(path);
+    }
+  };
+
   if (mBottomCreamMaskLayer && mBottomCreamMaskLayer->isVisible()) {
     // draw bottom cream mask
     painter->setPen(Qt::NoPen);
     painter->setBrush(mBottomCreamMaskLayer->getColor(highlight));
-    painter->drawPath(mCreamMask);
+    drawArea(mCreamMask);
   }
 
   if (mBottomStopMaskLayer && mBottomStopMaskLayer->isVisible()) {
     // draw bottom stop mask
     painter->setPen(Qt::NoPen);
     painter->setBrush(mBottomStopMaskLayer->getColor(highlight));
-    painter->drawPath(mStopMask);
+    drawArea(mStopMask);
   }
 
   if (mPadLayer && mPadLayer->isVisible()) {
     // draw pad
     painter->setPen(Qt::NoPen);
     painter->setBrush(mPadLayer->getColor(highlight));
-    painter->drawPath(mCopper);
+    drawArea(mCopper);
     // draw pad text
-    painter->setFont(mFont);
-    painter->setPen(mPadLayer->getColor(highlight).lighter(150));
-    painter->drawText(mShape.boundingRect(), Qt::AlignCenter,
-                      mPad.getDisplayText());
+    if (drawText) {
+      painter->setFont(mFont);
+      painter->setPen(mPadLayer->getColor(highlight).lighter(150));
+      painter->drawText(mShape.boundingRect(), Qt::AlignCenter,
+                        mPad.getDisplayText());
+    }
   }
 
   if (mTopStopMaskLayer && mTopStopMaskLayer->isVisible()) {
     // draw top stop mask
     painter->setPen(Qt::NoPen);
     painter->setBrush(mTopStopMaskLayer->getColor(highlight));
-    painter->drawPath(mStopMask);
+    drawArea(mStopMask);
   }
 
   if (mTopCreamMaskLayer && mTopCreamMaskLayer->isVisible()) {
     // draw top cream mask
     painter->setPen(Qt::NoPen);
     painter->setBrush(mTopCreamMaskLayer->getColor(highlight));
-    painter->drawPath(mCreamMask);
+    drawArea(mCreamMask);
   }
 }
 
@@ -50,8 +50,13 @@ BGI_Plane::BGI_Plane(BI_Plane& plane) noexcept
     mLineWidthPx(0),
     mVertexHandleRadiusPx(0),
     mVertexHandles(),
+    mSimplifiedAreasTolerance(100000),  // 0.1mm
     mOnLayerEditedSlot(*this, &BGI_Plane::layerEdited) {
   setFlag(QGraphicsItem::ItemIsSelectable, true);
+
+  // Planes are expensive to draw, but are rarely modified. So let's keep a
+  // rendered pixmap of them to make panning fast.
+  setCacheMode(QGraphicsItem::DeviceCoordinateCache);
   updateCacheAndRepaint();
 }
 
@@ -149,8 +154,11 @@ void BGI_Plane::updateCacheAndRepaint() noexcept {
 
   // get areas
   mAreas.clear();
+  mAreasSimplified.clear();
   for (const Path& r : mPlane.getFragments()) {
     mAreas.append(r.toQPainterPathPx());
+    mAreasSimplified.append(
+        toSimplifiedQPainterPathPx(r, mSimplifiedAreasTolerance));
     mBoundingRect = mBoundingRect.united(mAreas.last().boundingRect());
   }
 
@@ -215,11 +223,17 @@ void BGI_Plane::paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
       }
     }
 
-    // Draw plane only if plane should be visible.
+    // Draw plane only if plane should be visible. If the simplification
+    // tolerance is smaller than a device pixel, draw the simplified areas
+    // since the difference is not visible anyway.
     if (mPlane.isVisible()) {
+      const bool simplified = (mSimplifiedAreasTolerance.toPx() * lod) < 1;
       painter->setPen(Qt::NoPen);
       painter->setBrush(mLayer->getColor(selected));
-      foreach (const QPainterPath& area, mAreas) { painter->drawPath(area); }
+      foreach (const QPainterPath& area,
+               simplified ? mAreasSimplified : mAreas) {
+        painter->drawPath(area);
+      }
     }
   }
 }
@@ -273,6 +287,31 @@ void BGI_Plane::updateBoundingRectMargin() noexcept {
   update();
 }
 
+QPainterPath BGI_Plane::toSimplifiedQPainterPathPx(
+    const Path& path, const Length& tolerance) noexcept {
+  // Plane fragments consist of straight segments only (they are created by
+  // Clipper), so it's fine to ignore the arc angles here. Vertices closer than
+  // the tolerance to the previous vertex are skipped, except the last one to
+  // keep the path closed.
+  QPainterPath p;
+  const QVector<Vertex>& vertices = path.getVertices();
+  if (vertices.isEmpty()) {
+    return p;
+  }
+  Point lastPos = vertices.first().getPos();
+  p.moveTo(lastPos.toPxQPointF());
+  for (int i = 1; i < vertices.count(); ++i) {
+    const Point& pos = vertices.at(i).getPos();
+    const Point diff = pos - lastPos;
+    if ((i == vertices.count() - 1) || (diff.getX().abs() >= tolerance) ||
+        (diff.getY().abs() >= tolerance)) {
+      p.lineTo(pos.toPxQPointF());
+      lastPos = pos;
+    }
+  }
+  return p;
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
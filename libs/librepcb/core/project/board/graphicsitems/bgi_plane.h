@@ -95,6 +95,8 @@ private:  // Methods
                    GraphicsLayer::Event event) noexcept;
   void updateVisibility() noexcept;
   void updateBoundingRectMargin() noexcept;
+  static QPainterPath toSimplifiedQPainterPathPx(
+      const Path& path, const Length& tolerance) noexcept;
 
 private:  // Data
   // General Attributes
@@ -107,6 +109,7 @@ private:  // Data
   QPainterPath mShape;
   QPainterPath mOutline;
   QVector<QPainterPath> mAreas;
+  QVector<QPainterPath> mAreasSimplified;  ///< Drawn when zoomed out
   qreal mLineWidthPx;
   qreal mVertexHandleRadiusPx;
   struct VertexHandle {
@@ -114,6 +117,7 @@ private:  // Data
     qreal maxGlowRadiusPx;
   };
   QVector<VertexHandle> mVertexHandles;
+  const Length mSimplifiedAreasTolerance;
 
   // Slots
   GraphicsLayer::OnEditedSlot mOnLayerEditedSlot;
@@ -39,7 +39,11 @@ namespace librepcb {
  ******************************************************************************/
 
 BI_Base::BI_Base(Board& board) noexcept
-  : QObject(&board), mBoard(board), mIsAddedToBoard(false), mIsSelected(false) {
+  : QObject(&board),
+    mBoard(board),
+    mIsAddedToBoard(false),
+    mIsSelected(false),
+    mSceneItem(nullptr) {
 }
 
 BI_Base::~BI_Base() noexcept {
@@ -64,6 +68,11 @@ Circuit& BI_Base::getCircuit() const noexcept {
 
 void BI_Base::setSelected(bool selected) noexcept {
   mIsSelected = selected;
+  if (mSceneItem) {
+    // Selected items are typically modified or dragged around, so let views
+    // draw them on top of their cached scene content.
+    mBoard.getGraphicsScene().setOverlayItem(*mSceneItem, selected);
+  }
 }
 
 /*******************************************************************************
@@ -74,7 +83,9 @@ void BI_Base::addToBoard(QGraphicsItem* item) noexcept {
   Q_ASSERT(!mIsAddedToBoard);
   if (item) {
     mBoard.getGraphicsScene().addItem(*item);
+    mBoard.getGraphicsScene().setOverlayItem(*item, mIsSelected);
   }
+  mSceneItem = item;
   mIsAddedToBoard = true;
 }
 
@@ -83,6 +94,7 @@ void BI_Base::removeFromBoard(QGraphicsItem* item) noexcept {
   if (item) {
     mBoard.getGraphicsScene().removeItem(*item);
   }
+  mSceneItem = nullptr;
   mIsAddedToBoard = false;
 }
 
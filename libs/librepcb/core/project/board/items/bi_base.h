@@ -103,6 +103,9 @@ private:
   // General Attributes
   bool mIsAddedToBoard;
   bool mIsSelected;
+
+  /// The graphics item added to the scene, marked as overlay while selected
+  QGraphicsItem* mSceneItem;
 };
 
 /*******************************************************************************
@@ -239,6 +239,7 @@ void BI_Device::setPosition(const Point& pos) noexcept {
   if (pos != mPosition) {
     mPosition = pos;
     emit moved(mPosition);
+    mBoard.setModified(true);
   }
 }
 
@@ -246,6 +247,7 @@ void BI_Device::setRotation(const Angle& rot) noexcept {
   if (rot != mRotation) {
     mRotation = rot;
     emit rotated(mRotation);
+    mBoard.setModified(true);
   }
 }
 
@@ -256,6 +258,7 @@ void BI_Device::setMirrored(bool mirror) {
     }
     mMirrored = mirror;
     emit mirrored(mMirrored);
+    mBoard.setModified(true);
   }
 }
 
@@ -32,6 +32,7 @@
 #include "../../project.h"
 #include "../../projectlibrary.h"
 #include "../board.h"
+#include "../drc/boardcoppergeometrycache.h"
 #include "bi_device.h"
 #include "bi_footprintpad.h"
 
@@ -207,6 +208,8 @@ void BI_Footprint::addStrokeText(BI_StrokeText& text) {
     text.addToBoard();  // can throw
   }
   mStrokeTexts.append(&text);
+  mBoard.invalidateSelectionRectItems();
+  mBoard.setModified(true);
 }
 
 void BI_Footprint::removeStrokeText(BI_StrokeText& text) {
@@ -217,6 +220,8 @@ void BI_Footprint::removeStrokeText(BI_StrokeText& text) {
     text.removeFromBoard();  // can throw
   }
   mStrokeTexts.removeOne(&text);
+  mBoard.invalidateSelectionRectItems();
+  mBoard.setModified(true);
 }
 
 /*******************************************************************************
@@ -237,6 +242,7 @@ void BI_Footprint::addToBoard() {
     sgl.add([text]() { text->removeFromBoard(); });
   }
   BI_Base::addToBoard(mGraphicsItem.data());
+  mBoard.getCopperGeometryCache().invalidate(nullptr);
   sgl.dismiss();
 }
 
@@ -254,6 +260,7 @@ void BI_Footprint::removeFromBoard() {
     sgl.add([text]() { text->addToBoard(); });
   }
   BI_Base::removeFromBoard(mGraphicsItem.data());
+  mBoard.getCopperGeometryCache().invalidate(nullptr);
   sgl.dismiss();
 }
 
@@ -314,6 +321,7 @@ void BI_Footprint::deviceInstanceMoved(const Point& pos) {
     mBoard.scheduleAirWiresRebuild(pad->getCompSigInstNetSignal());
   }
   foreach (BI_StrokeText* text, mStrokeTexts) { text->updateGraphicsItems(); }
+  invalidateCopperGeometry();
 }
 
 void BI_Footprint::deviceInstanceRotated(const Angle& rot) {
@@ -323,6 +331,7 @@ void BI_Footprint::deviceInstanceRotated(const Angle& rot) {
     pad->updatePosition();
     mBoard.scheduleAirWiresRebuild(pad->getCompSigInstNetSignal());
   }
+  invalidateCopperGeometry();
 }
 
 void BI_Footprint::deviceInstanceMirrored(bool mirrored) {
@@ -333,6 +342,7 @@ void BI_Footprint::deviceInstanceMirrored(bool mirrored) {
     pad->updatePosition();
     mBoard.scheduleAirWiresRebuild(pad->getCompSigInstNetSignal());
   }
+  invalidateCopperGeometry();
 }
 
 /*******************************************************************************
@@ -346,6 +356,14 @@ void BI_Footprint::updateGraphicsItemTransform() noexcept {
   mGraphicsItem->setTransform(t);
 }
 
+void BI_Footprint::invalidateCopperGeometry() noexcept {
+  BoardCopperGeometryCache& cache = mBoard.getCopperGeometryCache();
+  cache.invalidate(nullptr);  // Polygons, circles and stroke texts.
+  foreach (const BI_FootprintPad* pad, mPads) {
+    cache.invalidate(pad->getCompSigInstNetSignal());
+  }
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
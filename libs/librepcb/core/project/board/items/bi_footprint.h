@@ -123,6 +123,7 @@ private:
   void init();
   void deinit() noexcept;
   void updateGraphicsItemTransform() noexcept;
+  void invalidateCopperGeometry() noexcept;
 
   // General
   BI_Device& mDevice;
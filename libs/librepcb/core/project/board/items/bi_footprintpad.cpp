@@ -30,6 +30,7 @@
 #include "../../circuit/componentinstance.h"
 #include "../../circuit/componentsignalinstance.h"
 #include "../../circuit/netsignal.h"
+#include "../drc/boardcoppergeometrycache.h"
 #include "bi_device.h"
 #include "bi_footprint.h"
 #include "bi_netsegment.h"
@@ -292,6 +293,8 @@ void BI_FootprintPad::componentSignalInstanceNetSignalChanged(NetSignal* from,
   }
   mBoard.scheduleAirWiresRebuild(from);
   mBoard.scheduleAirWiresRebuild(to);
+  mBoard.getCopperGeometryCache().invalidate(from);
+  mBoard.getCopperGeometryCache().invalidate(to);
 }
 
 /*******************************************************************************
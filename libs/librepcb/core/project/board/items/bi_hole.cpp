@@ -39,24 +39,27 @@ namespace librepcb {
  *  Constructors / Destructor
  ******************************************************************************/
 
-BI_Hole::BI_Hole(Board& board, const BI_Hole& other) : BI_Base(board) {
+BI_Hole::BI_Hole(Board& board, const BI_Hole& other)
+  : BI_Base(board), mOnHoleEditedSlot(*this, &BI_Hole::holeEdited) {
   mHole.reset(new Hole(Uuid::createRandom(), *other.mHole));
   init();
 }
 
 BI_Hole::BI_Hole(Board& board, const SExpression& node,
                  const Version& fileFormat)
-  : BI_Base(board) {
+  : BI_Base(board), mOnHoleEditedSlot(*this, &BI_Hole::holeEdited) {
   mHole.reset(new Hole(node, fileFormat));
   init();
 }
 
-BI_Hole::BI_Hole(Board& board, const Hole& hole) : BI_Base(board) {
+BI_Hole::BI_Hole(Board& board, const Hole& hole)
+  : BI_Base(board), mOnHoleEditedSlot(*this, &BI_Hole::holeEdited) {
   mHole.reset(new Hole(hole));
   init();
 }
 
 void BI_Hole::init() {
+  mHole->onEdited.attach(mOnHoleEditedSlot);
   mGraphicsItem.reset(new HoleGraphicsItem(*mHole, mBoard.getLayerStack()));
 }
 
@@ -114,6 +117,16 @@ void BI_Hole::setSelected(bool selected) noexcept {
   mGraphicsItem->setSelected(selected);
 }
 
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void BI_Hole::holeEdited(const Hole& hole, Hole::Event event) noexcept {
+  Q_UNUSED(hole);
+  Q_UNUSED(event);
+  mBoard.setModified(true);
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -82,10 +82,14 @@ public:
 
 private:  // Methods
   void init();
+  void holeEdited(const Hole& hole, Hole::Event event) noexcept;
 
 private:  // Data
   QScopedPointer<Hole> mHole;
   QScopedPointer<HoleGraphicsItem> mGraphicsItem;
+
+  // Slots
+  Hole::OnEditedSlot mOnHoleEditedSlot;
 };
 
 /*******************************************************************************
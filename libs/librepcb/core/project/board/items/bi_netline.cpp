@@ -25,6 +25,7 @@
 #include "../../../utils/scopeguard.h"
 #include "../../circuit/netsignal.h"
 #include "../boardlayerstack.h"
+#include "../drc/boardcoppergeometrycache.h"
 #include "bi_device.h"
 #include "bi_footprint.h"
 #include "bi_footprintpad.h"
@@ -154,6 +155,7 @@ void BI_NetLine::init() {
 }
 
 BI_NetLine::~BI_NetLine() noexcept {
+  mBoard.unscheduleNetLineUpdate(*this);
   mGraphicsItem.reset();
 }
 
@@ -198,12 +200,16 @@ void BI_NetLine::setLayer(GraphicsLayer& layer) {
   if (mTrace.setLayer(GraphicsLayerName(layer.getName()))) {
     mLayer = &layer;
     mGraphicsItem->updateCacheAndRepaint();
+    mBoard.getCopperGeometryCache().invalidate(mNetSegment.getNetSignal());
+    mBoard.setModified(true);
   }
 }
 
 void BI_NetLine::setWidth(const PositiveLength& width) noexcept {
   if (mTrace.setWidth(width)) {
     mGraphicsItem->updateCacheAndRepaint();
+    mBoard.getCopperGeometryCache().invalidate(mNetSegment.getNetSignal());
+    mBoard.setModified(true);
   }
 }
 
@@ -244,12 +250,17 @@ void BI_NetLine::removeFromBoard() {
     disconnect(mConnections.takeLast());
   }
 
+  mBoard.unscheduleNetLineUpdate(*this);
   BI_Base::removeFromBoard(mGraphicsItem.data());
   sg.dismiss();
 }
 
 void BI_NetLine::updateLine() noexcept {
-  mGraphicsItem->updateCacheAndRepaint();
+  if (mBoard.isBatchUpdateActive()) {
+    mBoard.scheduleNetLineUpdate(*this);
+  } else {
+    mGraphicsItem->updateCacheAndRepaint();
+  }
 }
 
 void BI_NetLine::serialize(SExpression& root) const {
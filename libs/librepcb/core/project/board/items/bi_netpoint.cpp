@@ -24,6 +24,7 @@
 
 #include "../../circuit/netsignal.h"
 #include "../../erc/ercmsg.h"
+#include "../drc/boardcoppergeometrycache.h"
 #include "bi_netsegment.h"
 
 #include <QtCore>
@@ -95,6 +96,8 @@ void BI_NetPoint::setPosition(const Point& position) noexcept {
     if (NetSignal* netsignal = mNetSegment.getNetSignal()) {
       mBoard.scheduleAirWiresRebuild(netsignal);
     }
+    mBoard.getCopperGeometryCache().invalidate(mNetSegment.getNetSignal());
+    mBoard.setModified(true);
   }
 }
 
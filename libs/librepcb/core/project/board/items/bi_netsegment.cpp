@@ -28,6 +28,7 @@
 #include "../../circuit/netsignal.h"
 #include "../../project.h"
 #include "../board.h"
+#include "../drc/boardcoppergeometrycache.h"
 #include "bi_device.h"
 #include "bi_footprint.h"
 #include "bi_footprintpad.h"
@@ -255,7 +256,10 @@ void BI_NetSegment::setNetSignal(NetSignal* netsignal) {
       }
       sgl.dismiss();
     }
+    mBoard.getCopperGeometryCache().invalidate(mNetSignal);
+    mBoard.getCopperGeometryCache().invalidate(netsignal);
     mNetSignal = netsignal;
+    mBoard.setModified(true);
   }
 }
 
@@ -302,6 +306,7 @@ void BI_NetSegment::addElements(const QList<BI_Via*>& vias,
   if (!isAddedToBoard()) {
     throw LogicError(__FILE__, __LINE__);
   }
+  mBoard.getCopperGeometryCache().invalidate(mNetSignal);
 
   ScopeGuardList sgl(netpoints.count() + netlines.count());
   foreach (BI_Via* via, vias) {
@@ -369,6 +374,8 @@ void BI_NetSegment::addElements(const QList<BI_Via*>& vias,
             .arg(mUuid.toStr()));
   }
 
+  mBoard.invalidateSelectionRectItems();
+  mBoard.setModified(true);
   sgl.dismiss();
 }
 
@@ -378,6 +385,7 @@ void BI_NetSegment::removeElements(const QList<BI_Via*>& vias,
   if (!isAddedToBoard()) {
     throw LogicError(__FILE__, __LINE__);
   }
+  mBoard.getCopperGeometryCache().invalidate(mNetSignal);
 
   ScopeGuardList sgl(netpoints.count() + netlines.count());
   foreach (BI_NetLine* netline, netlines) {
@@ -424,6 +432,8 @@ void BI_NetSegment::removeElements(const QList<BI_Via*>& vias,
             .arg(mUuid.toStr()));
   }
 
+  mBoard.invalidateSelectionRectItems();
+  mBoard.setModified(true);
   sgl.dismiss();
 }
 
@@ -436,6 +446,7 @@ void BI_NetSegment::addToBoard() {
     throw LogicError(__FILE__, __LINE__);
   }
 
+  mBoard.getCopperGeometryCache().invalidate(mNetSignal);
   ScopeGuardList sgl(mNetPoints.count() + mNetLines.count() + 1);
   if (mNetSignal) {
     mNetSignal->registerBoardNetSegment(*this);  // can throw
@@ -463,6 +474,7 @@ void BI_NetSegment::removeFromBoard() {
     throw LogicError(__FILE__, __LINE__);
   }
 
+  mBoard.getCopperGeometryCache().invalidate(mNetSignal);
   ScopeGuardList sgl(mNetPoints.count() + mNetLines.count() + 1);
   foreach (BI_NetLine* netline, mNetLines) {
     netline->removeFromBoard();  // can throw
@@ -494,18 +506,6 @@ void BI_NetSegment::selectAll() noexcept {
     netline->setSelected(netline->isSelectable());
 }
 
-void BI_NetSegment::setSelectionRect(const QRectF rectPx) noexcept {
-  foreach (BI_Via* via, mVias)
-    via->setSelected(via->isSelectable() &&
-                     via->getGrabAreaScenePx().intersects(rectPx));
-  foreach (BI_NetPoint* netpoint, mNetPoints)
-    netpoint->setSelected(netpoint->isSelectable() &&
-                          netpoint->getGrabAreaScenePx().intersects(rectPx));
-  foreach (BI_NetLine* netline, mNetLines)
-    netline->setSelected(netline->isSelectable() &&
-                         netline->getGrabAreaScenePx().intersects(rectPx));
-}
-
 void BI_NetSegment::clearSelection() const noexcept {
   foreach (BI_Via* via, mVias)
     via->setSelected(false);
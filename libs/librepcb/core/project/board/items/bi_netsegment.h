@@ -125,7 +125,6 @@ public:
   void addToBoard() override;
   void removeFromBoard() override;
   void selectAll() noexcept;
-  void setSelectionRect(const QRectF rectPx) noexcept;
   void clearSelection() const noexcept;
 
   /// @copydoc ::librepcb::SerializableObject::serialize()
@@ -27,6 +27,7 @@
 #include "../../circuit/netsignal.h"
 #include "../../project.h"
 #include "../boardplanefragmentsbuilder.h"
+#include "../drc/boardcoppergeometrycache.h"
 #include "../graphicsitems/bgi_plane.h"
 
 #include <QtCore>
@@ -133,6 +134,7 @@ void BI_Plane::setOutline(const Path& outline) noexcept {
   if (outline != mOutline) {
     mOutline = outline;
     mGraphicsItem->updateCacheAndRepaint();
+    mBoard.setModified(true);
   }
 }
 
@@ -140,6 +142,8 @@ void BI_Plane::setLayerName(const GraphicsLayerName& layerName) noexcept {
   if (layerName != mLayerName) {
     mLayerName = layerName;
     mGraphicsItem->updateCacheAndRepaint();
+    mBoard.getCopperGeometryCache().invalidate(mNetSignal);
+    mBoard.setModified(true);
   }
 }
 
@@ -154,44 +158,60 @@ void BI_Plane::setNetSignal(NetSignal& netsignal) {
       netsignal.registerBoardPlane(*this);  // can throw
       sg.dismiss();
     }
+    mBoard.getCopperGeometryCache().invalidate(mNetSignal);
+    mBoard.getCopperGeometryCache().invalidate(&netsignal);
     mNetSignal = &netsignal;
+    mBoard.setModified(true);
   }
 }
 
 void BI_Plane::setMinWidth(const UnsignedLength& minWidth) noexcept {
   if (minWidth != mMinWidth) {
     mMinWidth = minWidth;
+    mBoard.setModified(true);
   }
 }
 
 void BI_Plane::setMinClearance(const UnsignedLength& minClearance) noexcept {
   if (minClearance != mMinClearance) {
     mMinClearance = minClearance;
+    mBoard.setModified(true);
   }
 }
 
 void BI_Plane::setConnectStyle(BI_Plane::ConnectStyle style) noexcept {
   if (style != mConnectStyle) {
     mConnectStyle = style;
+    mBoard.setModified(true);
   }
 }
 
 void BI_Plane::setPriority(int priority) noexcept {
   if (priority != mPriority) {
     mPriority = priority;
+    mBoard.setModified(true);
   }
 }
 
 void BI_Plane::setKeepOrphans(bool keepOrphans) noexcept {
   if (keepOrphans != mKeepOrphans) {
     mKeepOrphans = keepOrphans;
+    mBoard.setModified(true);
   }
 }
 
+void BI_Plane::setFragments(const QVector<Path>& fragments) noexcept {
+  mFragments = fragments;
+  mGraphicsItem->updateCacheAndRepaint();
+  mBoard.getCopperGeometryCache().invalidate(mNetSignal);
+  mBoard.scheduleAirWiresRebuild(mNetSignal);
+}
+
 void BI_Plane::setVisible(bool visible) noexcept {
   if (visible != mIsVisible) {
     mIsVisible = visible;
     mGraphicsItem->update();
+    mBoard.setModified(true);
   }
 }
 
@@ -206,6 +226,7 @@ void BI_Plane::addToBoard() {
   mNetSignal->registerBoardPlane(*this);  // can throw
   BI_Base::addToBoard(mGraphicsItem.data());
   mGraphicsItem->updateCacheAndRepaint();  // TODO: remove this
+  mBoard.getCopperGeometryCache().invalidate(mNetSignal);
   mBoard.scheduleAirWiresRebuild(mNetSignal);
 }
 
@@ -215,19 +236,19 @@ void BI_Plane::removeFromBoard() {
   }
   mNetSignal->unregisterBoardPlane(*this);  // can throw
   BI_Base::removeFromBoard(mGraphicsItem.data());
+  mBoard.getCopperGeometryCache().invalidate(mNetSignal);
   mBoard.scheduleAirWiresRebuild(mNetSignal);
 }
 
 void BI_Plane::clear() noexcept {
   mFragments.clear();
   mGraphicsItem->updateCacheAndRepaint();
+  mBoard.getCopperGeometryCache().invalidate(mNetSignal);
 }
 
 void BI_Plane::rebuild() noexcept {
   BoardPlaneFragmentsBuilder builder(*this);
-  mFragments = builder.buildFragments();
-  mGraphicsItem->updateCacheAndRepaint();
-  mBoard.scheduleAirWiresRebuild(mNetSignal);
+  setFragments(builder.buildFragments());
 }
 
 void BI_Plane::serialize(SExpression& root) const {
@@ -98,6 +98,7 @@ public:
   void setConnectStyle(ConnectStyle style) noexcept;
   void setPriority(int priority) noexcept;
   void setKeepOrphans(bool keepOrphans) noexcept;
+  void setFragments(const QVector<Path>& fragments) noexcept;
   void setVisible(bool visible) noexcept;
 
   // General Methods
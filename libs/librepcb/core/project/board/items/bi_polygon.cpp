@@ -28,6 +28,7 @@
 #include "../../project.h"
 #include "../board.h"
 #include "../boardlayerstack.h"
+#include "../drc/boardcoppergeometrycache.h"
 
 #include <QtCore>
 
@@ -40,19 +41,24 @@ namespace librepcb {
  *  Constructors / Destructor
  ******************************************************************************/
 
-BI_Polygon::BI_Polygon(Board& board, const BI_Polygon& other) : BI_Base(board) {
+BI_Polygon::BI_Polygon(Board& board, const BI_Polygon& other)
+  : BI_Base(board),
+    mOnPolygonEditedSlot(*this, &BI_Polygon::polygonEdited) {
   mPolygon.reset(new Polygon(Uuid::createRandom(), *other.mPolygon));
   init();
 }
 
 BI_Polygon::BI_Polygon(Board& board, const SExpression& node,
                        const Version& fileFormat)
-  : BI_Base(board) {
+  : BI_Base(board),
+    mOnPolygonEditedSlot(*this, &BI_Polygon::polygonEdited) {
   mPolygon.reset(new Polygon(node, fileFormat));
   init();
 }
 
-BI_Polygon::BI_Polygon(Board& board, const Polygon& polygon) : BI_Base(board) {
+BI_Polygon::BI_Polygon(Board& board, const Polygon& polygon)
+  : BI_Base(board),
+    mOnPolygonEditedSlot(*this, &BI_Polygon::polygonEdited) {
   mPolygon.reset(new Polygon(polygon));
   init();
 }
@@ -61,13 +67,16 @@ BI_Polygon::BI_Polygon(Board& board, const Uuid& uuid,
                        const GraphicsLayerName& layerName,
                        const UnsignedLength& lineWidth, bool fill,
                        bool isGrabArea, const Path& path)
-  : BI_Base(board) {
+  : BI_Base(board),
+    mOnPolygonEditedSlot(*this, &BI_Polygon::polygonEdited) {
   mPolygon.reset(
       new Polygon(uuid, layerName, lineWidth, fill, isGrabArea, path));
   init();
 }
 
 void BI_Polygon::init() {
+  mPolygon->onEdited.attach(mOnPolygonEditedSlot);
+
   mGraphicsItem.reset(
       new PolygonGraphicsItem(*mPolygon, mBoard.getLayerStack()));
   mGraphicsItem->setEditable(true);
@@ -92,6 +101,7 @@ void BI_Polygon::addToBoard() {
     throw LogicError(__FILE__, __LINE__);
   }
   BI_Base::addToBoard(mGraphicsItem.data());
+  mBoard.getCopperGeometryCache().invalidate(nullptr);
 }
 
 void BI_Polygon::removeFromBoard() {
@@ -99,6 +109,7 @@ void BI_Polygon::removeFromBoard() {
     throw LogicError(__FILE__, __LINE__);
   }
   BI_Base::removeFromBoard(mGraphicsItem.data());
+  mBoard.getCopperGeometryCache().invalidate(nullptr);
 }
 
 void BI_Polygon::serialize(SExpression& root) const {
@@ -136,6 +147,18 @@ void BI_Polygon::boardAttributesChanged() {
   mGraphicsItem->update();
 }
 
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void BI_Polygon::polygonEdited(const Polygon& polygon,
+                               Polygon::Event event) noexcept {
+  Q_UNUSED(polygon);
+  Q_UNUSED(event);
+  mBoard.getCopperGeometryCache().invalidate(nullptr);
+  mBoard.setModified(true);
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
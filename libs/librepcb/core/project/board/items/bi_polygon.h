@@ -95,10 +95,14 @@ private slots:
 
 private:
   void init();
+  void polygonEdited(const Polygon& polygon, Polygon::Event event) noexcept;
 
   // General
   QScopedPointer<Polygon> mPolygon;
   QScopedPointer<PolygonGraphicsItem> mGraphicsItem;
+
+  // Slots
+  Polygon::OnEditedSlot mOnPolygonEditedSlot;
 };
 
 /*******************************************************************************
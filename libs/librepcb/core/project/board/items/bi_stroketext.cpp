@@ -25,12 +25,14 @@
 #include "../../../attribute/attributesubstitutor.h"
 #include "../../../font/strokefontpool.h"
 #include "../../../geometry/stroketext.h"
+#include "../../../graphics/graphicslayer.h"
 #include "../../../graphics/graphicsscene.h"
 #include "../../../graphics/linegraphicsitem.h"
 #include "../../../graphics/stroketextgraphicsitem.h"
 #include "../../project.h"
 #include "../board.h"
 #include "../boardlayerstack.h"
+#include "../drc/boardcoppergeometrycache.h"
 #include "./bi_footprint.h"
 
 #include <QtCore>
@@ -47,6 +49,7 @@ namespace librepcb {
 BI_StrokeText::BI_StrokeText(Board& board, const BI_StrokeText& other)
   : BI_Base(board),
     mFootprint(nullptr),
+    mIsOnCopperLayer(false),
     mOnStrokeTextEditedSlot(*this, &BI_StrokeText::strokeTextEdited) {
   mText.reset(new StrokeText(Uuid::createRandom(), *other.mText));
   init();
@@ -56,6 +59,7 @@ BI_StrokeText::BI_StrokeText(Board& board, const SExpression& node,
                              const Version& fileFormat)
   : BI_Base(board),
     mFootprint(nullptr),
+    mIsOnCopperLayer(false),
     mOnStrokeTextEditedSlot(*this, &BI_StrokeText::strokeTextEdited) {
   mText.reset(new StrokeText(node, fileFormat));
   init();
@@ -64,6 +68,7 @@ BI_StrokeText::BI_StrokeText(Board& board, const SExpression& node,
 BI_StrokeText::BI_StrokeText(Board& board, const StrokeText& text)
   : BI_Base(board),
     mFootprint(nullptr),
+    mIsOnCopperLayer(false),
     mOnStrokeTextEditedSlot(*this, &BI_StrokeText::strokeTextEdited) {
   mText.reset(new StrokeText(text));
   init();
@@ -71,6 +76,7 @@ BI_StrokeText::BI_StrokeText(Board& board, const StrokeText& text)
 
 void BI_StrokeText::init() {
   mText->onEdited.attach(mOnStrokeTextEditedSlot);
+  mIsOnCopperLayer = GraphicsLayer::isCopperLayer(*mText->getLayerName());
 
   mGraphicsItem.reset(
       new StrokeTextGraphicsItem(*mText, mBoard.getLayerStack(), getFont()));
@@ -149,6 +155,10 @@ void BI_StrokeText::addToBoard() {
   }
   BI_Base::addToBoard(mGraphicsItem.data());
   mBoard.getGraphicsScene().addItem(*mAnchorGraphicsItem);
+  mBoard.getGraphicsScene().setOverlayItem(*mAnchorGraphicsItem, true);
+  if (mIsOnCopperLayer) {
+    mBoard.getCopperGeometryCache().invalidate(nullptr);
+  }
 }
 
 void BI_StrokeText::removeFromBoard() {
@@ -157,6 +167,9 @@ void BI_StrokeText::removeFromBoard() {
   }
   BI_Base::removeFromBoard(mGraphicsItem.data());
   mBoard.getGraphicsScene().removeItem(*mAnchorGraphicsItem);
+  if (mIsOnCopperLayer) {
+    mBoard.getCopperGeometryCache().invalidate(nullptr);
+  }
 }
 
 void BI_StrokeText::serialize(SExpression& root) const {
@@ -201,6 +214,10 @@ void BI_StrokeText::setSelected(bool selected) noexcept {
  ******************************************************************************/
 
 void BI_StrokeText::boardOrFootprintAttributesChanged() {
+  // Substituted attributes may change the copper area of the text.
+  if (mIsOnCopperLayer) {
+    mBoard.getCopperGeometryCache().invalidate(nullptr);
+  }
   mGraphicsItem->updateText();
 }
 
@@ -211,6 +228,13 @@ void BI_StrokeText::boardOrFootprintAttributesChanged() {
 void BI_StrokeText::strokeTextEdited(const StrokeText& text,
                                      StrokeText::Event event) noexcept {
   Q_UNUSED(text);
+  // If the layer has changed, the copper of the old layer is affected too.
+  const bool wasOnCopperLayer = mIsOnCopperLayer;
+  mIsOnCopperLayer = GraphicsLayer::isCopperLayer(*mText->getLayerName());
+  if (mIsOnCopperLayer || wasOnCopperLayer) {
+    mBoard.getCopperGeometryCache().invalidate(nullptr);
+  }
+  mBoard.setModified(true);
   switch (event) {
     case StrokeText::Event::LayerNameChanged:
     case StrokeText::Event::PositionChanged:
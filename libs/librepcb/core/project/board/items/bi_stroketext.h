@@ -108,6 +108,7 @@ private:  // Data
   QScopedPointer<StrokeText> mText;
   QScopedPointer<StrokeTextGraphicsItem> mGraphicsItem;
   QScopedPointer<LineGraphicsItem> mAnchorGraphicsItem;
+  bool mIsOnCopperLayer;  ///< To detect moves from/to copper layers
 
   // Slots
   StrokeText::OnEditedSlot mOnStrokeTextEditedSlot;
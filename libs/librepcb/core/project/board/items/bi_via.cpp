@@ -24,6 +24,7 @@
 
 #include "../../circuit/netsignal.h"
 #include "../boardlayerstack.h"
+#include "../drc/boardcoppergeometrycache.h"
 #include "bi_netsegment.h"
 
 #include <QtCore>
@@ -96,24 +97,32 @@ void BI_Via::setPosition(const Point& position) noexcept {
     if (NetSignal* netsignal = mNetSegment.getNetSignal()) {
       mBoard.scheduleAirWiresRebuild(netsignal);
     }
+    mBoard.getCopperGeometryCache().invalidate(mNetSegment.getNetSignal());
+    mBoard.setModified(true);
   }
 }
 
 void BI_Via::setShape(Via::Shape shape) noexcept {
   if (mVia.setShape(shape)) {
     mGraphicsItem->updateCacheAndRepaint();
+    mBoard.getCopperGeometryCache().invalidate(mNetSegment.getNetSignal());
+    mBoard.setModified(true);
   }
 }
 
 void BI_Via::setSize(const PositiveLength& size) noexcept {
   if (mVia.setSize(size)) {
     mGraphicsItem->updateCacheAndRepaint();
+    mBoard.getCopperGeometryCache().invalidate(mNetSegment.getNetSignal());
+    mBoard.setModified(true);
   }
 }
 
 void BI_Via::setDrillDiameter(const PositiveLength& diameter) noexcept {
   if (mVia.setDrillDiameter(diameter)) {
     mGraphicsItem->updateCacheAndRepaint();
+    mBoard.getCopperGeometryCache().invalidate(mNetSegment.getNetSignal());
+    mBoard.setModified(true);
   }
 }
 
@@ -26,6 +26,7 @@
 #include "../../library/cmp/component.h"
 #include "../../serialization/sexpression.h"
 #include "../project.h"
+#include "../projectcache.h"
 #include "../projectsettings.h"
 #include "componentinstance.h"
 #include "netclass.h"
@@ -53,7 +54,7 @@ Circuit::Circuit(Project& project, const Version& fileFormat, bool create)
       NetClass* netclass = new NetClass(*this, ElementName("default"));
       addNetClass(*netclass);  // add a netclass with name "default"
     } else {
-      SExpression root = SExpression::parse(
+      SExpression root = mProject.getCache().parse(
           mDirectory->read("circuit.lp"), mDirectory->getAbsPath("circuit.lp"));
 
       // OK - file is open --> now load the whole circuit stuff
@@ -27,6 +27,8 @@
 #include "../board/items/bi_netsegment.h"
 #include "../board/items/bi_plane.h"
 #include "../erc/ercmsg.h"
+#include "../erc/ercmsglist.h"
+#include "../project.h"
 #include "../schematic/items/si_netsegment.h"
 #include "circuit.h"
 #include "componentinstance.h"
@@ -82,6 +84,7 @@ NetSignal::NetSignal(Circuit& circuit, NetClass& netclass,
 NetSignal::~NetSignal() noexcept {
   Q_ASSERT(!mIsAddedToCircuit);
   Q_ASSERT(!isUsed());
+  mCircuit.getProject().getErcMsgList().cancelScheduledUpdate(*this);
 }
 
 /*******************************************************************************
@@ -121,7 +124,7 @@ void NetSignal::setName(const CircuitIdentifier& name,
   }
   mName = name;
   mHasAutoName = isAutoName;
-  updateErcMessages();
+  scheduleErcMessagesUpdate();
   emit nameChanged(mName);
 }
 
@@ -142,7 +145,7 @@ void NetSignal::addToCircuit() {
   }
   mNetClass->registerNetSignal(*this);  // can throw
   mIsAddedToCircuit = true;
-  updateErcMessages();
+  scheduleErcMessagesUpdate();
 }
 
 void NetSignal::removeFromCircuit() {
@@ -157,84 +160,93 @@ void NetSignal::removeFromCircuit() {
   }
   mNetClass->unregisterNetSignal(*this);  // can throw
   mIsAddedToCircuit = false;
-  updateErcMessages();
+  scheduleErcMessagesUpdate();
 }
 
 void NetSignal::registerComponentSignal(ComponentSignalInstance& signal) {
-  if ((!mIsAddedToCircuit) || (mRegisteredComponentSignals.contains(&signal)) ||
+  if ((!mIsAddedToCircuit) ||
+      (mRegisteredComponentSignalsSet.contains(&signal)) ||
       (signal.getCircuit() != mCircuit)) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredComponentSignals.append(&signal);
-  updateErcMessages();
+  mRegisteredComponentSignalsSet.insert(&signal);
+  scheduleErcMessagesUpdate();
 }
 
 void NetSignal::unregisterComponentSignal(ComponentSignalInstance& signal) {
   if ((!mIsAddedToCircuit) ||
-      (!mRegisteredComponentSignals.contains(&signal))) {
+      (!mRegisteredComponentSignalsSet.contains(&signal))) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredComponentSignals.removeOne(&signal);
-  updateErcMessages();
+  mRegisteredComponentSignalsSet.remove(&signal);
+  scheduleErcMessagesUpdate();
 }
 
 void NetSignal::registerSchematicNetSegment(SI_NetSegment& netsegment) {
   if (!mIsAddedToCircuit) {
     throw LogicError(__FILE__, __LINE__, "NetSignal is not added to circuit.");
   }
-  if (mRegisteredSchematicNetSegments.contains(&netsegment)) {
+  if (mRegisteredSchematicNetSegmentsSet.contains(&netsegment)) {
     throw LogicError(__FILE__, __LINE__, "NetSegment already in NetSignal.");
   }
   if (netsegment.getCircuit() != mCircuit) {
     throw LogicError(__FILE__, __LINE__, "NetSegment is from other circuit.");
   }
   mRegisteredSchematicNetSegments.append(&netsegment);
-  updateErcMessages();
+  mRegisteredSchematicNetSegmentsSet.insert(&netsegment);
+  scheduleErcMessagesUpdate();
 }
 
 void NetSignal::unregisterSchematicNetSegment(SI_NetSegment& netsegment) {
   if ((!mIsAddedToCircuit) ||
-      (!mRegisteredSchematicNetSegments.contains(&netsegment))) {
+      (!mRegisteredSchematicNetSegmentsSet.contains(&netsegment))) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredSchematicNetSegments.removeOne(&netsegment);
-  updateErcMessages();
+  mRegisteredSchematicNetSegmentsSet.remove(&netsegment);
+  scheduleErcMessagesUpdate();
 }
 
 void NetSignal::registerBoardNetSegment(BI_NetSegment& netsegment) {
   if ((!mIsAddedToCircuit) ||
-      (mRegisteredBoardNetSegments.contains(&netsegment)) ||
+      (mRegisteredBoardNetSegmentsSet.contains(&netsegment)) ||
       (netsegment.getCircuit() != mCircuit)) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredBoardNetSegments.append(&netsegment);
-  updateErcMessages();
+  mRegisteredBoardNetSegmentsSet.insert(&netsegment);
+  scheduleErcMessagesUpdate();
 }
 
 void NetSignal::unregisterBoardNetSegment(BI_NetSegment& netsegment) {
   if ((!mIsAddedToCircuit) ||
-      (!mRegisteredBoardNetSegments.contains(&netsegment))) {
+      (!mRegisteredBoardNetSegmentsSet.contains(&netsegment))) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredBoardNetSegments.removeOne(&netsegment);
-  updateErcMessages();
+  mRegisteredBoardNetSegmentsSet.remove(&netsegment);
+  scheduleErcMessagesUpdate();
 }
 
 void NetSignal::registerBoardPlane(BI_Plane& plane) {
-  if ((!mIsAddedToCircuit) || (mRegisteredBoardPlanes.contains(&plane)) ||
+  if ((!mIsAddedToCircuit) || (mRegisteredBoardPlanesSet.contains(&plane)) ||
       (plane.getCircuit() != mCircuit)) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredBoardPlanes.append(&plane);
-  updateErcMessages();
+  mRegisteredBoardPlanesSet.insert(&plane);
+  scheduleErcMessagesUpdate();
 }
 
 void NetSignal::unregisterBoardPlane(BI_Plane& plane) {
-  if ((!mIsAddedToCircuit) || (!mRegisteredBoardPlanes.contains(&plane))) {
+  if ((!mIsAddedToCircuit) || (!mRegisteredBoardPlanesSet.contains(&plane))) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredBoardPlanes.removeOne(&plane);
-  updateErcMessages();
+  mRegisteredBoardPlanesSet.remove(&plane);
+  scheduleErcMessagesUpdate();
 }
 
 void NetSignal::serialize(SExpression& root) const {
@@ -257,7 +269,11 @@ bool NetSignal::checkAttributesValidity() const noexcept {
   return true;
 }
 
-void NetSignal::updateErcMessages() noexcept {
+void NetSignal::scheduleErcMessagesUpdate() noexcept {
+  mCircuit.getProject().getErcMsgList().scheduleUpdate(*this);
+}
+
+void NetSignal::updateScheduledErcMessages() noexcept {
   if (mIsAddedToCircuit && (!isUsed())) {
     if (!mErcMsgUnusedNetSignal) {
       mErcMsgUnusedNetSignal.reset(
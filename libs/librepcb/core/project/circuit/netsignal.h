@@ -123,7 +123,8 @@ signals:
 
 private:
   bool checkAttributesValidity() const noexcept;
-  void updateErcMessages() noexcept;
+  void scheduleErcMessagesUpdate() noexcept;
+  void updateScheduledErcMessages() noexcept override;
 
   // General
   Circuit& mCircuit;
@@ -137,10 +138,16 @@ private:
   NetClass* mNetClass;
 
   // Registered Elements of this NetSignal
+  // The lists keep the registration order (for deterministic iterations),
+  // the sets allow fast lookups. Note that unregistering is still O(n).
   QList<ComponentSignalInstance*> mRegisteredComponentSignals;
+  QSet<ComponentSignalInstance*> mRegisteredComponentSignalsSet;
   QList<SI_NetSegment*> mRegisteredSchematicNetSegments;
+  QSet<SI_NetSegment*> mRegisteredSchematicNetSegmentsSet;
   QList<BI_NetSegment*> mRegisteredBoardNetSegments;
+  QSet<BI_NetSegment*> mRegisteredBoardNetSegmentsSet;
   QList<BI_Plane*> mRegisteredBoardPlanes;
+  QSet<BI_Plane*> mRegisteredBoardPlanesSet;
 
   // ERC Messages
   /// @brief the ERC message for unused netsignals
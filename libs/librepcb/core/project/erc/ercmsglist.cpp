@@ -39,7 +39,7 @@ namespace librepcb {
  ******************************************************************************/
 
 ErcMsgList::ErcMsgList(Project& project)
-  : QObject(&project), mProject(project) {
+  : QObject(&project), mProject(project), mUpdateBatchDepth(0) {
 }
 
 ErcMsgList::~ErcMsgList() noexcept {
@@ -73,6 +73,42 @@ void ErcMsgList::update(ErcMsg* ercMsg) noexcept {
   emit ercMsgChanged(ercMsg);
 }
 
+void ErcMsgList::beginUpdateBatch() noexcept {
+  ++mUpdateBatchDepth;
+}
+
+void ErcMsgList::endUpdateBatch() noexcept {
+  Q_ASSERT(mUpdateBatchDepth > 0);
+  if (--mUpdateBatchDepth == 0) {
+    updateScheduledProviders();
+  }
+}
+
+void ErcMsgList::scheduleUpdate(IF_ErcMsgProvider& provider) noexcept {
+  if (mUpdateBatchDepth == 0) {
+    provider.updateScheduledErcMessages();
+  } else if (!mScheduledProvidersSet.contains(&provider)) {
+    mScheduledProviders.append(&provider);
+    mScheduledProvidersSet.insert(&provider);
+  }
+}
+
+void ErcMsgList::cancelScheduledUpdate(IF_ErcMsgProvider& provider) noexcept {
+  if (mScheduledProvidersSet.remove(&provider)) {
+    mScheduledProviders.removeOne(&provider);
+  }
+}
+
+void ErcMsgList::updateScheduledProviders() noexcept {
+  // Note: Updating a provider might schedule other providers, so process the
+  // list until it is empty.
+  while (!mScheduledProviders.isEmpty()) {
+    IF_ErcMsgProvider* provider = mScheduledProviders.takeFirst();
+    mScheduledProvidersSet.remove(provider);
+    provider->updateScheduledErcMessages();
+  }
+}
+
 void ErcMsgList::restoreIgnoreState() {
   QString fp = "circuit/erc.lp";
   if (mProject.getDirectory().fileExists(fp)) {
@@ -100,6 +136,7 @@ void ErcMsgList::restoreIgnoreState() {
 }
 
 void ErcMsgList::save() {
+  updateScheduledProviders();
   SExpression doc(serializeToDomElement("librepcb_erc"));  // can throw
   mProject.getDirectory().write("circuit/erc.lp",
                                 doc.toByteArray());  // can throw
@@ -34,6 +34,7 @@
 namespace librepcb {
 
 class ErcMsg;
+class IF_ErcMsgProvider;
 class Project;
 
 /*******************************************************************************
@@ -43,6 +44,13 @@ class Project;
 /**
  * @brief The ErcMsgList class contains a list of ERC messages which are visible
  * for the user
+ *
+ * To avoid re-evaluating the ERC messages of a provider again and again during
+ * bulk operations (e.g. loading a project or pasting many items), providers
+ * request an update with #scheduleUpdate(). Outside of an update batch, the
+ * update is performed immediately. Within a batch (see #beginUpdateBatch()),
+ * each scheduled provider is updated only once when the batch ends or when
+ * #updateScheduledProviders() is called.
  */
 class ErcMsgList final : public QObject, public SerializableObject {
   Q_OBJECT
@@ -61,6 +69,11 @@ public:
   void add(ErcMsg* ercMsg) noexcept;
   void remove(ErcMsg* ercMsg) noexcept;
   void update(ErcMsg* ercMsg) noexcept;
+  void beginUpdateBatch() noexcept;
+  void endUpdateBatch() noexcept;
+  void scheduleUpdate(IF_ErcMsgProvider& provider) noexcept;
+  void cancelScheduledUpdate(IF_ErcMsgProvider& provider) noexcept;
+  void updateScheduledProviders() noexcept;
   void restoreIgnoreState();
   void save();
 
@@ -82,6 +95,11 @@ private:  // Methods
 
   // Misc
   QList<ErcMsg*> mItems;  ///< contains all visible ERC messages
+
+  // Update Batching
+  int mUpdateBatchDepth;  ///< nesting level of #beginUpdateBatch()
+  QList<IF_ErcMsgProvider*> mScheduledProviders;  ///< in scheduling order
+  QSet<IF_ErcMsgProvider*> mScheduledProvidersSet;  ///< for fast lookup
 };
 
 /*******************************************************************************
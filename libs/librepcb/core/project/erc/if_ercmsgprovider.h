@@ -63,6 +63,16 @@ public:
 
   // Getters
   virtual const char* getErcMsgOwnerClassName() const noexcept = 0;
+
+  // General Methods
+
+  /**
+   * @brief Update the ERC messages of this provider
+   *
+   * Called by ::librepcb::ErcMsgList for providers which requested an update
+   * with ::librepcb::ErcMsgList::scheduleUpdate().
+   */
+  virtual void updateScheduledErcMessages() noexcept {}
 };
 
 /*******************************************************************************
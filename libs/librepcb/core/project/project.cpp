@@ -29,9 +29,11 @@
 #include "../fileio/versionfile.h"
 #include "../font/strokefontpool.h"
 #include "../serialization/sexpression.h"
+#include "../tracer.h"
 #include "board/board.h"
 #include "circuit/circuit.h"
 #include "erc/ercmsglist.h"
+#include "projectcache.h"
 #include "projectlibrary.h"
 #include "projectmetadata.h"
 #include "projectsettings.h"
@@ -55,6 +57,7 @@ Project::Project(std::unique_ptr<TransactionalDirectory> directory,
     AttributeProvider(),
     mDirectory(std::move(directory)),
     mFilename(filename) {
+  const TraceZone traceZone("Project::Project");
   qDebug().nospace() << (create ? "Create project " : "Open project ")
                      << getFilepath().toNative() << "...";
 
@@ -113,6 +116,11 @@ Project::Project(std::unique_ptr<TransactionalDirectory> directory,
   // constructor.
 
   try {
+    // open the cache to avoid parsing unmodified files again
+    mCache.reset(new ProjectCache(getPath(),
+                                  ProjectCache::getDefaultFilePath(getPath()),
+                                  mDirectory->isWritable()));
+
     // copy and/or load stroke fonts
     TransactionalDirectory fontobeneDir(*mDirectory, "resources/fontobene");
     if (create) {
@@ -138,7 +146,7 @@ Project::Project(std::unique_ptr<TransactionalDirectory> directory,
     } else {
       QString fp = "project/metadata.lp";
       SExpression root =
-          SExpression::parse(mDirectory->read(fp), mDirectory->getAbsPath(fp));
+          mCache->parse(mDirectory->read(fp), mDirectory->getAbsPath(fp));
       mProjectMetadata.reset(new ProjectMetadata(root, fileFormat));
     }
 
@@ -150,6 +158,7 @@ Project::Project(std::unique_ptr<TransactionalDirectory> directory,
         new ProjectLibrary(std::unique_ptr<TransactionalDirectory>(
             new TransactionalDirectory(*mDirectory, "library"))));
     mErcMsgList.reset(new ErcMsgList(*this));
+    mErcMsgList->beginUpdateBatch();  // evaluate ERC only once after loading
     mCircuit.reset(new Circuit(*this, fileFormat, create));
 
     // Load all schematic layers
@@ -159,7 +168,7 @@ Project::Project(std::unique_ptr<TransactionalDirectory> directory,
     if (!create) {
       QString fp = "schematics/schematics.lp";
       SExpression schRoot =
-          SExpression::parse(mDirectory->read(fp), mDirectory->getAbsPath(fp));
+          mCache->parse(mDirectory->read(fp), mDirectory->getAbsPath(fp));
       foreach (const SExpression& node, schRoot.getChildren("schematic")) {
         FilePath fp =
             FilePath::fromRelative(getPath(), node.getChild("@0").getValue());
@@ -175,7 +184,7 @@ Project::Project(std::unique_ptr<TransactionalDirectory> directory,
     if (!create) {
       QString fp = "boards/boards.lp";
       SExpression brdRoot =
-          SExpression::parse(mDirectory->read(fp), mDirectory->getAbsPath(fp));
+          mCache->parse(mDirectory->read(fp), mDirectory->getAbsPath(fp));
       foreach (const SExpression& node, brdRoot.getChildren("board")) {
         FilePath fp =
             FilePath::fromRelative(getPath(), node.getChild("@0").getValue());
@@ -188,12 +197,26 @@ Project::Project(std::unique_ptr<TransactionalDirectory> directory,
     }
 
     // at this point, the whole circuit with all schematics and boards is
-    // successfully loaded, so the ERC list now contains all the correct ERC
-    // messages. So we can now restore the ignore state of each ERC message from
-    // the file.
+    // successfully loaded, so after evaluating all scheduled ERC updates the
+    // ERC list contains all the correct ERC messages. So we can now restore the
+    // ignore state of each ERC message from the file.
+    mErcMsgList->endUpdateBatch();
     mErcMsgList->restoreIgnoreState();  // can throw
 
+    // All loaded schematics and boards are now in sync with their files, so
+    // they don't need to be serialized again until they get modified. Files
+    // of an older file format are always rewritten on the next save though.
+    if ((!create) && (fileFormat == qApp->getFileFormatVersion())) {
+      foreach (Schematic* schematic, mSchematics) {
+        schematic->setModified(false);
+      }
+      foreach (Board* board, mBoards) { board->setModified(false); }
+    }
+
     if (create) save();  // write all files to file system
+
+    // store newly parsed files in the cache for the next time
+    saveCache();
   } catch (...) {
     // free the allocated memory in the reverse order of their allocation...
     foreach (Board* board, mBoards) {
@@ -216,6 +239,9 @@ Project::Project(std::unique_ptr<TransactionalDirectory> directory,
 }
 
 Project::~Project() noexcept {
+  // store derived data which was modified since the last explicit save
+  saveCache();
+
   // free the allocated memory in the reverse order of their allocation
 
   // delete all boards and schematics (and catch all thrown exceptions)
@@ -500,16 +526,19 @@ void Project::save() {
   foreach (Schematic* schematic, mRemovedSchematics) {
     schematic->save();  // can throw
   }
-  // Save all added schematics (*.lp files)
+  // Save all added schematics (*.lp files), skipping unmodified ones
   foreach (Schematic* schematic, mSchematics) {
-    schematic->save();  // can throw
+    if (schematic->isModified()) {
+      schematic->save();  // can throw
+    }
   }
 
   // Save all removed boards (*.lp files)
   foreach (Board* board, mRemovedBoards) {
     board->save();  // can throw
   }
-  // Save all added boards (*.lp files)
+  // Save all added boards (*.lp files). Unmodified boards only save their
+  // user settings, see Board::save().
   foreach (Board* board, mBoards) {
     board->save();  // can throw
   }
@@ -518,6 +547,15 @@ void Project::save() {
   mProjectMetadata->updateLastModified();
 }
 
+void Project::saveCache() noexcept {
+  if (!mDirectory->isWritable()) {
+    return;
+  }
+  // Persist derived data (e.g. plane fragments) for faster reopening
+  foreach (Board* board, mBoards) { board->saveToCache(); }
+  mCache->save();
+}
+
 /*******************************************************************************
  *  Inherited from AttributeProvider
  ******************************************************************************/
@@ -41,6 +41,7 @@ namespace librepcb {
 class Board;
 class Circuit;
 class ErcMsgList;
+class ProjectCache;
 class ProjectLibrary;
 class ProjectMetadata;
 class ProjectSettings;
@@ -120,6 +121,13 @@ public:
 
   TransactionalDirectory& getDirectory() noexcept { return *mDirectory; }
 
+  /**
+   * @brief Get the binary cache used to speed up opening the project
+   *
+   * @return A reference to the ProjectCache object
+   */
+  ProjectCache& getCache() const noexcept { return *mCache; }
+
   /**
    * @brief Get the StrokeFontPool which contains all stroke fonts of the
    * project
@@ -347,10 +355,23 @@ public:
   /**
    * @brief Save the project to the transactional file system
    *
+   * Schematics and boards which were not modified since the last save are
+   * not serialized again (see ::librepcb::Schematic::isModified() and
+   * ::librepcb::Board::isModified()).
+   *
    * @throw Exception     If an error occurred.
    */
   void save();
 
+  /**
+   * @brief Write the project cache (see #getCache())
+   *
+   * Not done by #save() since that is also called for every autosave, while
+   * the cache only needs to be written on explicit saves and when closing
+   * the project. Errors are only logged since the cache is optional.
+   */
+  void saveCache() noexcept;
+
   // Inherited from AttributeProvider
   /// @copydoc ::librepcb::AttributeProvider::getUserDefinedAttributeValue()
   QString getUserDefinedAttributeValue(const QString& key) const
@@ -431,6 +452,7 @@ private:
   QString mFilename;  ///< the name of the *.lpp project file
 
   // General
+  QScopedPointer<ProjectCache> mCache;  ///< binary cache of derived data
   QScopedPointer<StrokeFontPool>
       mStrokeFontPool;  ///< all fonts from ./resources/fontobene/
   QScopedPointer<ProjectMetadata>
@@ -0,0 +1,286 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "projectcache.h"
+
+#include "../application.h"
+#include "../exceptions.h"
+#include "../fileio/fileutils.h"
+#include "../serialization/sexpression.h"
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Constants
+ ******************************************************************************/
+
+static const char* sMagic = "LIBREPCB-PROJECT-CACHE";
+// Must be incremented whenever the structure of the cache file changes.
+static const quint32 sFormatVersion = 1;
+static const QDataStream::Version sStreamVersion = QDataStream::Qt_5_5;
+// Limits for the cache files of all projects in the same directory.
+static const int sMaxAgeDays = 90;
+static const qint64 sMaxTotalSize = 1024 * 1024 * 1024;
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+ProjectCache::ProjectCache(const FilePath& projectDir,
+                           const FilePath& filePath, bool writable) noexcept
+  : mProjectDir(projectDir),
+    mFilePath(filePath),
+    mWritable(writable),
+    mFile(),
+    mMappedData(nullptr),
+    mEntries(),
+    mModified(false) {
+  load();
+}
+
+ProjectCache::~ProjectCache() noexcept {
+  mEntries.clear();  // must not reference the mapped memory anymore
+  unmap();
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+QByteArray ProjectCache::get(const QString& key,
+                             const QByteArray& inputHash) noexcept {
+  auto it = mEntries.find(key);
+  if ((it != mEntries.end()) && (it->inputHash == inputHash)) {
+    it->used = true;
+    // Return a deep copy since the data might point into the mapped file.
+    return QByteArray(it->data.constData(), it->data.size());
+  }
+  return QByteArray();
+}
+
+void ProjectCache::set(const QString& key, const QByteArray& inputHash,
+                       const QByteArray& data) noexcept {
+  mEntries.insert(key, Entry{inputHash, data, true});
+  mModified = true;
+}
+
+SExpression ProjectCache::parse(const QByteArray& content,
+                                const FilePath& filePath) {
+  const QString key = "sexpr:" % filePath.toRelative(mProjectDir);
+  const QByteArray hash = calcHash(content);
+  auto it = mEntries.find(key);
+  if ((it != mEntries.end()) && (it->inputHash == hash)) {
+    it->used = true;
+    try {
+      QDataStream stream(it->data);
+      stream.setVersion(sStreamVersion);
+      return SExpression::readBinary(stream, filePath);  // can throw
+    } catch (const Exception& e) {
+      qWarning() << "Ignoring invalid project cache entry:" << key;
+    }
+  }
+
+  SExpression root = SExpression::parse(content, filePath);  // can throw
+  QByteArray data;
+  QDataStream stream(&data, QIODevice::WriteOnly);
+  stream.setVersion(sStreamVersion);
+  root.writeBinary(stream);
+  set(key, hash, data);
+  return root;
+}
+
+void ProjectCache::save() noexcept {
+  if ((!mWritable) || (!mModified) || (!mFilePath.isValid())) {
+    return;
+  }
+
+  // Build the index of all used entries, followed by their data.
+  QByteArray index;
+  QByteArray data;
+  QDataStream stream(&index, QIODevice::WriteOnly);
+  stream.setVersion(sStreamVersion);
+  QStringList keys;
+  for (auto it = mEntries.constBegin(); it != mEntries.constEnd(); ++it) {
+    if (it->used) {
+      keys.append(it.key());
+    }
+  }
+  keys.sort();
+  stream << QByteArray(sMagic) << sFormatVersion
+         << qApp->getAppVersion().toStr() << static_cast<quint32>(keys.count());
+  foreach (const QString& key, keys) {
+    const Entry& entry = mEntries[key];
+    stream << key << entry.inputHash << static_cast<quint64>(data.size())
+           << static_cast<quint64>(entry.data.size());
+    data.append(entry.data);
+  }
+
+  // Detach the kept entries from the mapped file since it is going to be
+  // overwritten (on some platforms, mapped files can't be replaced at all).
+  QHash<QString, Entry> entries;
+  foreach (const QString& key, keys) {
+    Entry entry = mEntries[key];
+    entry.data = QByteArray(entry.data.constData(), entry.data.size());
+    entries.insert(key, entry);
+  }
+  mEntries = entries;
+  unmap();
+
+  try {
+    FileUtils::writeFile(mFilePath, index + data);  // can throw
+    mModified = false;
+  } catch (const Exception& e) {
+    qWarning() << "Failed to write project cache:" << e.getMsg();
+  }
+  removeOutdatedFiles(mFilePath.getParentDir(), sMaxAgeDays, sMaxTotalSize);
+}
+
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+QByteArray ProjectCache::calcHash(const QByteArray& input) noexcept {
+  return QCryptographicHash::hash(input, QCryptographicHash::Md5);
+}
+
+FilePath ProjectCache::getDefaultFilePath(const FilePath& projectDir) noexcept {
+  const QString cacheDir =
+      QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+  if (cacheDir.isEmpty()) {
+    return FilePath();
+  }
+  const QString hash = calcHash(projectDir.toStr().toUtf8()).toHex();
+  return FilePath(cacheDir).getPathTo("projects/" % hash % ".lpcache");
+}
+
+void ProjectCache::removeOutdatedFiles(const FilePath& dir, int maxAgeDays,
+                                       qint64 maxTotalSize) noexcept {
+  const QDateTime minLastModified =
+      QDateTime::currentDateTime().addDays(-maxAgeDays);
+  QFileInfoList files = QDir(dir.toStr()).entryInfoList(
+      {"*.lpcache"}, QDir::Files, QDir::Time);  // Newest first.
+  qint64 totalSize = 0;
+  foreach (const QFileInfo& file, files) {
+    totalSize += file.size();
+    if ((file.lastModified() < minLastModified) ||
+        (totalSize > maxTotalSize)) {
+      // Use QFile::remove() instead of FileUtils::removeFile() since here we
+      // don't need an exception if the removal fails (no critical error).
+      if (QFile::remove(file.absoluteFilePath())) {
+        qDebug() << "Removed outdated project cache:" << file.fileName();
+      } else {
+        qWarning() << "Failed to remove outdated project cache:"
+                   << file.absoluteFilePath();
+      }
+    }
+  }
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void ProjectCache::load() noexcept {
+  if ((!mFilePath.isValid()) || (!mFilePath.isExistingFile())) {
+    return;
+  }
+
+  mFile.setFileName(mFilePath.toStr());
+  if (mFile.open(QIODevice::ReadOnly)) {
+    mMappedData = mFile.map(0, mFile.size());
+  }
+  if (!mMappedData) {
+    qWarning() << "Failed to open project cache:" << mFile.errorString();
+    unmap();
+    return;
+  }
+
+  // Note: The data of the entries is not copied, it points into the mapped
+  // memory instead.
+  const QByteArray content = QByteArray::fromRawData(
+      reinterpret_cast<const char*>(mMappedData), mFile.size());
+  QDataStream stream(content);
+  stream.setVersion(sStreamVersion);
+  QByteArray magic;
+  quint32 formatVersion = 0;
+  QString appVersion;
+  quint32 count = 0;
+  stream >> magic >> formatVersion >> appVersion >> count;
+  if ((stream.status() != QDataStream::Ok) || (magic != sMagic) ||
+      (formatVersion != sFormatVersion) ||
+      (appVersion != qApp->getAppVersion().toStr())) {
+    qInfo() << "Ignoring outdated project cache:" << mFilePath.toNative();
+    unmap();
+    return;
+  }
+  struct IndexEntry {
+    QString key;
+    QByteArray inputHash;
+    quint64 offset;
+    quint64 size;
+  };
+  QVector<IndexEntry> indexEntries;
+  for (quint32 i = 0; (i < count) && (stream.status() == QDataStream::Ok);
+       ++i) {
+    IndexEntry entry;
+    stream >> entry.key >> entry.inputHash >> entry.offset >> entry.size;
+    indexEntries.append(entry);
+  }
+  const quint64 dataStart = static_cast<quint64>(stream.device()->pos());
+  foreach (const IndexEntry& entry, indexEntries) {
+    if ((stream.status() != QDataStream::Ok) ||
+        (dataStart + entry.offset + entry.size >
+         static_cast<quint64>(content.size()))) {
+      qWarning() << "Ignoring corrupt project cache:" << mFilePath.toNative();
+      mEntries.clear();
+      unmap();
+      return;
+    }
+    mEntries.insert(
+        entry.key,
+        Entry{entry.inputHash,
+              QByteArray::fromRawData(
+                  content.constData() + dataStart + entry.offset,
+                  static_cast<int>(entry.size)),
+              false});
+  }
+  qDebug() << "Loaded project cache with" << mEntries.count() << "entries.";
+}
+
+void ProjectCache::unmap() noexcept {
+  if (mMappedData) {
+    mFile.unmap(mMappedData);
+    mMappedData = nullptr;
+  }
+  mFile.close();
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
@@ -0,0 +1,178 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_CORE_PROJECTCACHE_H
+#define LIBREPCB_CORE_PROJECTCACHE_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../fileio/filepath.h"
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+class SExpression;
+
+/*******************************************************************************
+ *  Class ProjectCache
+ ******************************************************************************/
+
+/**
+ * @brief Optional binary cache to speed up reopening a project
+ *
+ * Stores data derived from the project files (e.g. the parsed S-Expression
+ * files) in a binary file in the user's cache directory (see
+ * #getDefaultFilePath()), so the project directory is not polluted with
+ * files which must not be committed to version control. Every entry is
+ * stored together with a hash of its inputs (e.g. the content of the source
+ * file), so outdated entries are detected and ignored. The cache file is
+ * memory-mapped when opening the project, thus only the entries actually used
+ * need to be read from the disk.
+ *
+ * The cache is purely optional: if it is missing, outdated, corrupt or was
+ * written by another application version, it is ignored and rebuilt the next
+ * time #save() is called. To avoid filling up the cache directory with files
+ * of projects which are not opened anymore, #save() also removes old cache
+ * files from the same directory (see #removeOutdatedFiles()).
+ */
+class ProjectCache final {
+public:
+  // Constructors / Destructor
+  ProjectCache() = delete;
+  ProjectCache(const ProjectCache& other) = delete;
+  ProjectCache(const FilePath& projectDir, const FilePath& filePath,
+               bool writable) noexcept;
+  ~ProjectCache() noexcept;
+
+  // Getters
+  const FilePath& getFilePath() const noexcept { return mFilePath; }
+
+  // General Methods
+
+  /**
+   * @brief Get the data of a cache entry
+   *
+   * @param key         Unique key of the entry.
+   * @param inputHash   Hash of the inputs the data was derived from.
+   *
+   * @return The cached data, or a null byte array if there is no entry with
+   *         the given key or if it was derived from different inputs.
+   */
+  QByteArray get(const QString& key, const QByteArray& inputHash) noexcept;
+
+  /**
+   * @brief Add or replace a cache entry
+   *
+   * @param key         Unique key of the entry.
+   * @param inputHash   Hash of the inputs the data was derived from.
+   * @param data        The data to cache.
+   */
+  void set(const QString& key, const QByteArray& inputHash,
+           const QByteArray& data) noexcept;
+
+  /**
+   * @brief Parse an S-Expression file, using the cached tree if available
+   *
+   * Drop-in replacement for ::librepcb::SExpression::parse().
+   *
+   * @param content   The file content.
+   * @param filePath  The path of the file (must be inside the project).
+   *
+   * @return The parsed S-Expression tree.
+   *
+   * @throw ::librepcb::Exception if the content could not be parsed.
+   */
+  SExpression parse(const QByteArray& content, const FilePath& filePath);
+
+  /**
+   * @brief Write the cache file, if there are any new entries
+   *
+   * Entries which were not used since the cache was loaded are removed to
+   * avoid growing the cache with outdated data.
+   *
+   * @note Errors are only logged since the cache is optional.
+   */
+  void save() noexcept;
+
+  // Static Methods
+  static QByteArray calcHash(const QByteArray& input) noexcept;
+
+  /**
+   * @brief Get the default cache file path of a project
+   *
+   * @param projectDir  The project directory.
+   *
+   * @return The path "projects/<hash>.lpcache" within the user's cache
+   *         directory, where the hash is derived from the project directory
+   *         path. Invalid if there is no cache directory.
+   */
+  static FilePath getDefaultFilePath(const FilePath& projectDir) noexcept;
+
+  /**
+   * @brief Remove old cache files from a directory
+   *
+   * First all cache files which were not modified within the given maximum
+   * age are removed. Then the least recently modified files are removed
+   * until the total size of the remaining files is within the given limit.
+   *
+   * @param dir           The directory containing the cache files.
+   * @param maxAgeDays    Maximum age of cache files in days.
+   * @param maxTotalSize  Maximum total size of all cache files in bytes.
+   *
+   * @note Errors are only logged since the cache is optional.
+   */
+  static void removeOutdatedFiles(const FilePath& dir, int maxAgeDays,
+                                  qint64 maxTotalSize) noexcept;
+
+  // Operator Overloadings
+  ProjectCache& operator=(const ProjectCache& rhs) = delete;
+
+private:  // Methods
+  void load() noexcept;
+  void unmap() noexcept;
+
+private:  // Types
+  struct Entry {
+    QByteArray inputHash;
+    QByteArray data;  ///< Might point into the memory-mapped cache file!
+    bool used;  ///< Whether the entry was used since it was loaded
+  };
+
+private:  // Data
+  FilePath mProjectDir;
+  FilePath mFilePath;
+  bool mWritable;
+  QFile mFile;  ///< The memory-mapped cache file (if opened)
+  uchar* mMappedData;
+  QHash<QString, Entry> mEntries;
+  bool mModified;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif
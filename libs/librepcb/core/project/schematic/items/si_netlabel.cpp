@@ -88,6 +88,7 @@ void SI_NetLabel::setPosition(const Point& position) noexcept {
   if (mNetLabel.setPosition(position)) {
     mGraphicsItem->setPos(position.toPxQPointF());
     updateAnchor();
+    mSchematic.setModified(true);
   }
 }
 
@@ -96,12 +97,14 @@ void SI_NetLabel::setRotation(const Angle& rotation) noexcept {
     mGraphicsItem->setRotation(-rotation.toDeg());
     mGraphicsItem->updateCacheAndRepaint();
     updateAnchor();
+    mSchematic.setModified(true);
   }
 }
 
 void SI_NetLabel::setMirrored(const bool mirrored) noexcept {
   if (mNetLabel.setMirrored(mirrored)) {
     mGraphicsItem->updateCacheAndRepaint();
+    mSchematic.setModified(true);
   }
 }
 
@@ -109,6 +109,7 @@ NetSignal& SI_NetLine::getNetSignalOfNetSegment() const noexcept {
 void SI_NetLine::setWidth(const UnsignedLength& width) noexcept {
   if (mNetLine.setWidth(width)) {
     mGraphicsItem->updateCacheAndRepaint();
+    mSchematic.setModified(true);
   }
 }
 
@@ -98,6 +98,7 @@ void SI_NetPoint::setPosition(const Point& position) noexcept {
   if (mJunction.setPosition(position)) {
     mGraphicsItem->setPos(position.toPxQPointF());
     foreach (SI_NetLine* line, mRegisteredNetLines) { line->updateLine(); }
+    mSchematic.setModified(true);
   }
 }
 
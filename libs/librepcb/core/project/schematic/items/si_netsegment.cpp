@@ -221,6 +221,7 @@ void SI_NetSegment::setNetSignal(NetSignal& netsignal) {
       sg.dismiss();
     }
     mNetSignal = &netsignal;
+    mSchematic.setModified(true);
   }
 }
 
@@ -306,6 +307,7 @@ void SI_NetSegment::addNetPointsAndNetLines(
 
   updateAllNetLabelAnchors();
 
+  mSchematic.setModified(true);
   sgl.dismiss();
 }
 
@@ -350,6 +352,7 @@ void SI_NetSegment::removeNetPointsAndNetLines(
 
   updateAllNetLabelAnchors();
 
+  mSchematic.setModified(true);
   sgl.dismiss();
 }
 
@@ -379,6 +382,7 @@ void SI_NetSegment::addNetLabel(SI_NetLabel& netlabel) {
   // add to schematic
   netlabel.addToSchematic();  // can throw
   mNetLabels.append(&netlabel);
+  mSchematic.setModified(true);
 }
 
 void SI_NetSegment::removeNetLabel(SI_NetLabel& netlabel) {
@@ -388,6 +392,7 @@ void SI_NetSegment::removeNetLabel(SI_NetLabel& netlabel) {
   // remove from schematic
   netlabel.removeFromSchematic();  // can throw
   mNetLabels.removeOne(&netlabel);
+  mSchematic.setModified(true);
 }
 
 void SI_NetSegment::updateAllNetLabelAnchors() noexcept {
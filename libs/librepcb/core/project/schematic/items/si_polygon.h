@@ -81,10 +81,14 @@ public:
 
 private:  // Methods
   void init();
+  void polygonEdited(const Polygon& polygon, Polygon::Event event) noexcept;
 
 private:  // Attributes
   QScopedPointer<Polygon> mPolygon;
   QScopedPointer<PolygonGraphicsItem> mGraphicsItem;
+
+  // Slots
+  Polygon::OnEditedSlot mOnPolygonEditedSlot;
 };
 
 /*******************************************************************************
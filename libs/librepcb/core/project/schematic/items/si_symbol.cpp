@@ -156,6 +156,7 @@ void SI_Symbol::setPosition(const Point& newPos) noexcept {
     mPosition = newPos;
     mGraphicsItem->setPosition(newPos);
     foreach (SI_SymbolPin* pin, mPins) { pin->updatePosition(false); }
+    mSchematic.setModified(true);
   }
 }
 
@@ -164,6 +165,7 @@ void SI_Symbol::setRotation(const Angle& newRotation) noexcept {
     mRotation = newRotation;
     mGraphicsItem->updateRotationAndMirror();
     foreach (SI_SymbolPin* pin, mPins) { pin->updatePosition(true); }
+    mSchematic.setModified(true);
   }
 }
 
@@ -172,6 +174,7 @@ void SI_Symbol::setMirrored(bool newMirrored) noexcept {
     mMirrored = newMirrored;
     mGraphicsItem->updateRotationAndMirror();
     foreach (SI_SymbolPin* pin, mPins) { pin->updatePosition(true); }
+    mSchematic.setModified(true);
   }
 }
 
@@ -81,10 +81,14 @@ public:
 private:  // Methods
   void init();
   void schematicAttributesChanged() noexcept;
+  void textEdited(const Text& text, Text::Event event) noexcept;
 
 private:  // Attributes
   Text mText;
   QScopedPointer<TextGraphicsItem> mGraphicsItem;
+
+  // Slots
+  Text::OnEditedSlot mOnTextEditedSlot;
 };
 
 /*******************************************************************************
@@ -30,6 +30,7 @@
 #include "../../types/gridproperties.h"
 #include "../../utils/scopeguardlist.h"
 #include "../project.h"
+#include "../projectcache.h"
 #include "items/si_netlabel.h"
 #include "items/si_netline.h"
 #include "items/si_netpoint.h"
@@ -60,6 +61,7 @@ Schematic::Schematic(Project& project,
     mProject(project),
     mDirectory(std::move(directory)),
     mIsAddedToProject(false),
+    mIsModified(true),
     mUuid(Uuid::createRandom()),
     mName("New Page") {
   try {
@@ -73,7 +75,7 @@ Schematic::Schematic(Project& project,
       // load default grid properties
       mGridProperties.reset(new GridProperties());
     } else {
-      SExpression root = SExpression::parse(
+      SExpression root = mProject.getCache().parse(
           mDirectory->read(getFilePath().getFilename()), getFilePath());
 
       // the schematic seems to be ready to open, so we will create all needed
@@ -196,10 +198,12 @@ bool Schematic::isEmpty() const noexcept {
 
 void Schematic::setGridProperties(const GridProperties& grid) noexcept {
   *mGridProperties = grid;
+  setModified(true);
 }
 
 void Schematic::setName(const ElementName& name) noexcept {
   mName = name;
+  setModified(true);
   emit mProject.attributesChanged();
 }
 
@@ -229,6 +233,7 @@ void Schematic::addSymbol(SI_Symbol& symbol) {
   // add to schematic
   symbol.addToSchematic();  // can throw
   mSymbols.append(&symbol);
+  setModified(true);
   emit symbolAdded(symbol);
 }
 
@@ -239,6 +244,7 @@ void Schematic::removeSymbol(SI_Symbol& symbol) {
   // remove from schematic
   symbol.removeFromSchematic();  // can throw
   mSymbols.removeOne(&symbol);
+  setModified(true);
   emit symbolRemoved(symbol);
 }
 
@@ -268,6 +274,7 @@ void Schematic::addNetSegment(SI_NetSegment& netsegment) {
   // add to schematic
   netsegment.addToSchematic();  // can throw
   mNetSegments.append(&netsegment);
+  setModified(true);
 }
 
 void Schematic::removeNetSegment(SI_NetSegment& netsegment) {
@@ -277,6 +284,7 @@ void Schematic::removeNetSegment(SI_NetSegment& netsegment) {
   // remove from schematic
   netsegment.removeFromSchematic();  // can throw
   mNetSegments.removeOne(&netsegment);
+  setModified(true);
 }
 
 /*******************************************************************************
@@ -305,6 +313,7 @@ void Schematic::addPolygon(SI_Polygon& polygon) {
   // add to schematic
   polygon.addToSchematic();  // can throw
   mPolygons.append(&polygon);
+  setModified(true);
 }
 
 void Schematic::removePolygon(SI_Polygon& polygon) {
@@ -314,6 +323,7 @@ void Schematic::removePolygon(SI_Polygon& polygon) {
   // remove from schematic
   polygon.removeFromSchematic();  // can throw
   mPolygons.removeOne(&polygon);
+  setModified(true);
 }
 
 /*******************************************************************************
@@ -341,6 +351,7 @@ void Schematic::addText(SI_Text& text) {
   // add to schematic
   text.addToSchematic();  // can throw
   mTexts.append(&text);
+  setModified(true);
 }
 
 void Schematic::removeText(SI_Text& text) {
@@ -350,6 +361,7 @@ void Schematic::removeText(SI_Text& text) {
   // remove from schematic
   text.removeFromSchematic();  // can throw
   mTexts.removeOne(&text);
+  setModified(true);
 }
 
 /*******************************************************************************
@@ -382,6 +394,7 @@ void Schematic::addToProject() {
 
   mIsAddedToProject = true;
   updateIcon();
+  setModified(true);
   sgl.dismiss();
 }
 
@@ -410,6 +423,7 @@ void Schematic::removeFromProject() {
   }
 
   mIsAddedToProject = false;
+  setModified(true);
   sgl.dismiss();
 }
 
@@ -422,6 +436,7 @@ void Schematic::save() {
   } else {
     mDirectory->removeDirRecursively();  // can throw
   }
+  setModified(false);
 }
 
 void Schematic::selectAll() noexcept {
@@ -126,9 +126,31 @@ public:
   GraphicsScene& getGraphicsScene() const noexcept { return *mGraphicsScene; }
   bool isEmpty() const noexcept;
 
+  /**
+   * @brief Check whether the schematic was modified since it was saved the
+   *        last time
+   *
+   * Used by ::librepcb::Project::save() to skip serializing unmodified
+   * schematics.
+   *
+   * @return Whether the schematic needs to be saved or not
+   */
+  bool isModified() const noexcept { return mIsModified; }
+
   // Setters: General
   void setGridProperties(const GridProperties& grid) noexcept;
 
+  /**
+   * @brief Mark the schematic as modified (or unmodified)
+   *
+   * All methods modifying the schematic content call this automatically, so
+   * normally it doesn't need to be called from outside.
+   *
+   * @param modified  Whether the schematic content differs from the saved
+   *                  files
+   */
+  void setModified(bool modified) noexcept { mIsModified = modified; }
+
   // Getters: Attributes
   const Uuid& getUuid() const noexcept { return mUuid; }
   const ElementName& getName() const noexcept { return mName; }
@@ -211,6 +233,7 @@ private:
   Project& mProject;  ///< A reference to the Project object (from the ctor)
   std::unique_ptr<TransactionalDirectory> mDirectory;
   bool mIsAddedToProject;
+  bool mIsModified;  ///< Whether #save() needs to serialize the schematic
 
   QScopedPointer<GraphicsScene> mGraphicsScene;
   QScopedPointer<GridProperties> mGridProperties;
@@ -177,11 +177,29 @@ SExpression& SExpression::appendChild(const SExpression& child) {
 }
 
 QByteArray SExpression::toByteArray() const {
-  QString str = toString(0);  // can throw
-  if (!str.endsWith('\n')) {
-    str += '\n';  // newline at end of file
+  // Serialize directly into an UTF-8 encoded byte array to avoid building and
+  // concatenating (and finally converting) temporary QStrings for every node.
+  QByteArray out;
+  out.reserve(estimateByteCount(0) + 1);  // Avoid reallocations while writing.
+  writeTo(out, 0);  // can throw
+  if (!out.endsWith('\n')) {
+    out += '\n';  // newline at end of file
+  }
+  return out;
+}
+
+void SExpression::writeBinary(QDataStream& stream) const {
+  // Compact representation for caching parsed files, see readBinary().
+  stream << static_cast<quint8>(mType);
+  if (mType != Type::LineBreak) {
+    stream << mValue;
+  }
+  if (mType == Type::List) {
+    stream << static_cast<quint32>(mChildren.count());
+    foreach (const SExpression& child, mChildren) {
+      child.writeBinary(stream);
+    }
   }
-  return str.toUtf8();
 }
 
 /*******************************************************************************
@@ -249,20 +267,39 @@ bool SExpression::isValidTokenChar(const QChar& c) noexcept {
       ((c >= '0') && (c <= '9')) || allowedSpecialChars.contains(c);
 }
 
-QString SExpression::toString(int indent) const {
+int SExpression::estimateByteCount(int indent) const noexcept {
+  // Note: This is only an estimate of the output size of writeTo() since the
+  // escaping, UTF-8 encoding and indentation rules are ignored.
+  if (mType == Type::List) {
+    int count = mValue.length() + 2;
+    foreach (const SExpression& child, mChildren) {
+      count += child.estimateByteCount(indent + 1) + 1;
+    }
+    return count;
+  } else if (mType == Type::String) {
+    return mValue.length() + 2;
+  } else if (mType == Type::LineBreak) {
+    return indent + 1;
+  } else {
+    return mValue.length();
+  }
+}
+
+void SExpression::writeTo(QByteArray& out, int indent) const {
   if (mType == Type::List) {
     if (!isValidToken(mValue)) {
       throw LogicError(
           __FILE__, __LINE__,
           QString("Invalid S-Expression list name: %1").arg(mValue));
     }
-    QString str = '(' + mValue;
+    out += '(';
+    out += mValue.toUtf8();
     bool lastCharIsSpace = false;
     const int lastIndex = mChildren.count() - 1;
     for (int i = 0; i < mChildren.count(); ++i) {
       const SExpression& child = mChildren.at(i);
       if ((!lastCharIsSpace) && (!child.isLineBreak())) {
-        str += ' ';
+        out += ' ';
       }
       const bool nextChildIsLineBreak =
           (i < lastIndex) && mChildren.at(i + 1).isLineBreak();
@@ -272,19 +309,24 @@ QString SExpression::toString(int indent) const {
       if (lastCharIsSpace && (i == lastIndex)) {
         --currentIndent;
       }
-      str += child.toString(currentIndent);
+      child.writeTo(out, currentIndent);  // can throw
     }
-    return str + ')';
+    out += ')';
   } else if (mType == Type::Token) {
     if (!isValidToken(mValue)) {
       throw LogicError(__FILE__, __LINE__,
                        QString("Invalid S-Expression token: %1").arg(mValue));
     }
-    return mValue;
+    out += mValue.toUtf8();
   } else if (mType == Type::String) {
-    return '"' + escapeString(mValue) + '"';
+    out += '"';
+    out += escapeString(mValue).toUtf8();
+    out += '"';
   } else if (mType == Type::LineBreak) {
-    return '\n' + QString(' ').repeated(indent);
+    out += '\n';
+    for (int i = 0; i < indent; ++i) {
+      out += ' ';
+    }
   } else {
     throw LogicError(__FILE__, __LINE__);
   }
@@ -328,6 +370,39 @@ SExpression SExpression::parse(const QByteArray& content,
   return root;
 }
 
+SExpression SExpression::readBinary(QDataStream& stream,
+                                    const FilePath& filePath) {
+  quint8 type = 0;
+  stream >> type;
+  SExpression node;
+  node.mType = static_cast<Type>(type);
+  switch (node.mType) {
+    case Type::List:
+    case Type::Token:
+    case Type::String:
+      stream >> node.mValue;
+      break;
+    case Type::LineBreak:
+      break;
+    default:
+      throw FileParseError(__FILE__, __LINE__, filePath, -1, -1, QString(),
+                           "Invalid binary S-Expression node type.");
+  }
+  if (node.mType == Type::List) {
+    quint32 count = 0;
+    stream >> count;
+    for (quint32 i = 0; (i < count) && (stream.status() == QDataStream::Ok);
+         ++i) {
+      node.mChildren.append(readBinary(stream, filePath));  // can throw
+    }
+  }
+  if (stream.status() != QDataStream::Ok) {
+    throw FileParseError(__FILE__, __LINE__, filePath, -1, -1, QString(),
+                         "Unexpected end of binary S-Expression data.");
+  }
+  return node;
+}
+
 bool& SExpression::legacyMode() noexcept {
   static bool v01 = (qApp->getFileFormatVersion() < Version::fromString("0.2"));
   return v01;
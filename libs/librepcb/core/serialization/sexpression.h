@@ -174,6 +174,7 @@ public:
     return appendList(child).appendChild(obj);
   }
   QByteArray toByteArray() const;
+  void writeBinary(QDataStream& stream) const;
 
   // Operator Overloadings
   SExpression& operator=(const SExpression& rhs) noexcept;
@@ -184,6 +185,7 @@ public:
   static SExpression createString(const QString& string);
   static SExpression createLineBreak();
   static SExpression parse(const QByteArray& content, const FilePath& filePath);
+  static SExpression readBinary(QDataStream& stream, const FilePath& filePath);
   static bool& legacyMode() noexcept;
 
 private:  // Methods
@@ -205,7 +207,8 @@ private:  // Methods
   static QString escapeString(const QString& string) noexcept;
   static bool isValidToken(const QString& token) noexcept;
   static bool isValidTokenChar(const QChar& c) noexcept;
-  QString toString(int indent) const;
+  int estimateByteCount(int indent) const noexcept;
+  void writeTo(QByteArray& out, int indent) const;
 
 private:  // Data
   Type mType;
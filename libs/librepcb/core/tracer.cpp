@@ -0,0 +1,154 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "tracer.h"
+
+#include "exceptions.h"
+#include "fileio/fileutils.h"
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+Tracer::Tracer() noexcept : mEnabled(false) {
+  mTimer.start();
+
+  const QString outputFile = qgetenv("LIBREPCB_TRACE_FILE");
+  if (!outputFile.isEmpty()) {
+    mOutputFilePath.setPath(QFileInfo(outputFile).absoluteFilePath());
+    mEnabled = true;
+  }
+}
+
+Tracer::~Tracer() noexcept {
+}
+
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+QVector<Tracer::Event> Tracer::getEvents() const noexcept {
+  QMutexLocker lock(&mMutex);
+  return mEvents;
+}
+
+/*******************************************************************************
+ *  Setters
+ ******************************************************************************/
+
+void Tracer::setEnabled(bool enabled) noexcept {
+  mEnabled = enabled;
+}
+
+void Tracer::setOutputFilePath(const FilePath& fp) noexcept {
+  QMutexLocker lock(&mMutex);
+  mOutputFilePath = fp;
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+void Tracer::addZone(const char* name, qint64 startNs, qint64 endNs) noexcept {
+  QMutexLocker lock(&mMutex);
+  mEvents.append(
+      Event{name, 'X', startNs, endNs - startNs, 0, getCurrentThreadId()});
+}
+
+void Tracer::addCounter(const char* name, qint64 value) noexcept {
+  const qint64 timestamp = getTimestampNs();
+  QMutexLocker lock(&mMutex);
+  mEvents.append(Event{name, 'C', timestamp, 0, value, getCurrentThreadId()});
+}
+
+void Tracer::clear() noexcept {
+  QMutexLocker lock(&mMutex);
+  mEvents.clear();
+}
+
+QByteArray Tracer::toChromeTraceJson() const noexcept {
+  const qint64 pid = QCoreApplication::applicationPid();
+  QJsonArray events;
+  foreach (const Event& event, getEvents()) {
+    QJsonObject obj;
+    obj.insert("name", QString::fromUtf8(event.name));
+    obj.insert("cat", "librepcb");
+    obj.insert("ph", QString(QChar(event.phase)));
+    obj.insert("ts", event.timestampNs / qreal(1000));  // Microseconds.
+    obj.insert("pid", pid);
+    obj.insert("tid", static_cast<qint64>(event.threadId));
+    if (event.phase == 'X') {
+      obj.insert("dur", event.durationNs / qreal(1000));
+    } else {
+      obj.insert("args", QJsonObject{{"value", event.value}});
+    }
+    events.append(obj);
+  }
+  QJsonObject root;
+  root.insert("traceEvents", events);
+  root.insert("displayTimeUnit", "ns");
+  return QJsonDocument(root).toJson(QJsonDocument::Compact);
+}
+
+void Tracer::finish() noexcept {
+  FilePath fp;
+  {
+    QMutexLocker lock(&mMutex);
+    fp = mOutputFilePath;
+  }
+  if ((!isEnabled()) || (!fp.isValid())) {
+    return;
+  }
+  try {
+    FileUtils::writeFile(fp, toChromeTraceJson());  // can throw
+    qInfo() << "Wrote trace to" << fp.toNative();
+  } catch (const Exception& e) {
+    qCritical() << "Failed to write trace:" << e.getMsg();
+  }
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+quint64 Tracer::getCurrentThreadId() noexcept {
+  // Note: Must be called with mMutex locked.
+  const Qt::HANDLE handle = QThread::currentThreadId();
+  auto it = mThreadIds.find(handle);
+  if (it == mThreadIds.end()) {
+    it = mThreadIds.insert(handle, mThreadIds.count() + 1);
+  }
+  return *it;
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
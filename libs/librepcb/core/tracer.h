@@ -0,0 +1,213 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_CORE_TRACER_H
+#define LIBREPCB_CORE_TRACER_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "fileio/filepath.h"
+
+#include <QtCore>
+
+#include <atomic>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Class Tracer
+ ******************************************************************************/
+
+/**
+ * @brief Lightweight recorder for timing zones and counters
+ *
+ * The tracer is compiled in, but disabled by default. While disabled,
+ * ::librepcb::TraceZone and #counter() only cost a relaxed atomic load.
+ * While enabled, every finished zone and every counter value is recorded
+ * together with a nanosecond timestamp and the ID of the calling thread.
+ * The recorded events can be exported in the Chrome trace event format,
+ * which can be viewed with `chrome://tracing`, Perfetto or Speedscope.
+ *
+ * The tracer gets enabled automatically if the environment variable
+ * `LIBREPCB_TRACE_FILE` is set. Its value is used as the output file path,
+ * which is written by #finish() (called by the applications on exit). The
+ * command line interface additionally provides the `--trace` option.
+ *
+ * @note All methods are thread-safe.
+ */
+class Tracer final {
+public:
+  // Types
+  struct Event {
+    const char* name;  ///< Must be a string literal (not copied!)
+    char phase;  ///< 'X' for complete zones, 'C' for counters
+    qint64 timestampNs;  ///< Start time since the tracer was created
+    qint64 durationNs;  ///< Duration of zones, 0 for counters
+    qint64 value;  ///< Value of counters, 0 for zones
+    quint64 threadId;  ///< Sequential ID of the recording thread
+  };
+
+  // Constructors / Destructor
+  Tracer(const Tracer& other) = delete;
+
+  // Getters
+  bool isEnabled() const noexcept {
+    return mEnabled.load(std::memory_order_relaxed);
+  }
+  const FilePath& getOutputFilePath() const noexcept {
+    return mOutputFilePath;
+  }
+  qint64 getTimestampNs() const noexcept { return mTimer.nsecsElapsed(); }
+  QVector<Event> getEvents() const noexcept;
+
+  // Setters
+  void setEnabled(bool enabled) noexcept;
+  void setOutputFilePath(const FilePath& fp) noexcept;
+
+  // General Methods
+
+  /**
+   * @brief Record a finished zone
+   *
+   * @param name      Name of the zone (must be a string literal).
+   * @param startNs   Start timestamp, see #getTimestampNs().
+   * @param endNs     End timestamp, see #getTimestampNs().
+   */
+  void addZone(const char* name, qint64 startNs, qint64 endNs) noexcept;
+
+  /**
+   * @brief Record the current value of a counter
+   *
+   * Does nothing if the tracer is disabled.
+   *
+   * @param name      Name of the counter (must be a string literal).
+   * @param value     Current value.
+   */
+  void addCounter(const char* name, qint64 value) noexcept;
+
+  /**
+   * @brief Discard all recorded events
+   */
+  void clear() noexcept;
+
+  /**
+   * @brief Export all recorded events in the Chrome trace event format
+   *
+   * @return JSON document
+   */
+  QByteArray toChromeTraceJson() const noexcept;
+
+  /**
+   * @brief Write the recorded events to the output file, if enabled
+   *
+   * Does nothing if the tracer is disabled or no output file is set.
+   * Errors are only logged since tracing is a diagnostic feature.
+   */
+  void finish() noexcept;
+
+  // Static Methods
+
+  /**
+   * @brief Get the singleton instance
+   *
+   * @return The tracer
+   */
+  static Tracer& instance() noexcept {
+    static Tracer tracer;
+    return tracer;
+  }
+
+  /**
+   * @brief Convenience shortcut for #addCounter() on the singleton
+   */
+  static void counter(const char* name, qint64 value) noexcept {
+    Tracer& tracer = instance();
+    if (tracer.isEnabled()) {
+      tracer.addCounter(name, value);
+    }
+  }
+
+  // Operator Overloadings
+  Tracer& operator=(const Tracer& rhs) = delete;
+
+private:  // Methods
+  Tracer() noexcept;
+  ~Tracer() noexcept;
+  quint64 getCurrentThreadId() noexcept;
+
+private:  // Data
+  std::atomic<bool> mEnabled;
+  QElapsedTimer mTimer;
+  FilePath mOutputFilePath;
+  mutable QMutex mMutex;  ///< Protects the members below
+  QVector<Event> mEvents;
+  QHash<Qt::HANDLE, quint64> mThreadIds;
+};
+
+/*******************************************************************************
+ *  Class TraceZone
+ ******************************************************************************/
+
+/**
+ * @brief Measures the lifetime of a scope and records it in the ::Tracer
+ *
+ * Usage:
+ * @code
+ * void Board::rebuildAllPlanes() noexcept {
+ *   const TraceZone traceZone("Board::rebuildAllPlanes");
+ *   ...
+ * }
+ * @endcode
+ */
+class TraceZone final {
+public:
+  // Constructors / Destructor
+  TraceZone() = delete;
+  TraceZone(const TraceZone& other) = delete;
+  explicit TraceZone(const char* name) noexcept
+    : mName(name),
+      mStartNs(Tracer::instance().isEnabled()
+                   ? Tracer::instance().getTimestampNs()
+                   : -1) {}
+  ~TraceZone() noexcept {
+    if (mStartNs >= 0) {
+      Tracer& tracer = Tracer::instance();
+      tracer.addZone(mName, mStartNs, tracer.getTimestampNs());
+    }
+  }
+
+  // Operator Overloadings
+  TraceZone& operator=(const TraceZone& rhs) = delete;
+
+private:  // Data
+  const char* mName;
+  qint64 mStartNs;  ///< -1 if the tracer was disabled at construction
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif
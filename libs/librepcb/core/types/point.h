@@ -73,9 +73,14 @@ class Angle;
  * pixels is also wrong! You should use Point.toPxQPointF().y() instead for this
  * purpose.
  *
+ * @note This class intentionally does not inherit from
+ *       ::librepcb::SerializableObject to avoid the overhead of a vtable
+ *       pointer, since there are millions of points (e.g. in paths) in large
+ *       projects.
+ *
  * @see class Length
  */
-class Point final : public SerializableObject {
+class Point final {
 public:
   // Constructors / Destructor
 
@@ -395,8 +400,15 @@ public:
   Point& mirror(Qt::Orientation orientation,
                 const Point& center = Point(0, 0)) noexcept;
 
+  /// @copydoc ::librepcb::SerializableObject::serializeToDomElement()
+  SExpression serializeToDomElement(const QString& name) const {
+    SExpression root = SExpression::createList(name);
+    serialize(root);
+    return root;
+  }
+
   /// @copydoc ::librepcb::SerializableObject::serialize()
-  void serialize(SExpression& root) const override;
+  void serialize(SExpression& root) const;
 
   // Static Functions
 
@@ -526,5 +538,6 @@ inline uint qHash(const Point& key, uint seed = 0) noexcept {
 }  // namespace librepcb
 
 Q_DECLARE_METATYPE(librepcb::Point)
+Q_DECLARE_TYPEINFO(librepcb::Point, Q_MOVABLE_TYPE);
 
 #endif
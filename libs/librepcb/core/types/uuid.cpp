@@ -22,7 +22,6 @@
  ******************************************************************************/
 #include "uuid.h"
 
-#include <QRegularExpressionValidator>
 #include <QtCore>
 
 /*******************************************************************************
@@ -30,74 +29,58 @@
  ******************************************************************************/
 namespace librepcb {
 
+/*******************************************************************************
+ *  Non-Member Functions
+ ******************************************************************************/
+
+static inline ushort charCode(const QChar& chr) noexcept {
+  return chr.unicode();
+}
+
+static inline ushort charCode(char chr) noexcept {
+  return static_cast<uchar>(chr);
+}
+
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+QString Uuid::toStr() const noexcept {
+  static const char hex[] = "0123456789abcdef";
+  QString str(36, QChar('-'));
+  QChar* data = str.data();
+  int pos = 0;
+  for (int i = 0; i < 16; ++i) {
+    if ((i == 4) || (i == 6) || (i == 8) || (i == 10)) {
+      ++pos;  // skip '-'
+    }
+    const quint64 word = (i < 8) ? mHi : mLo;
+    const int byte = (word >> (8 * (7 - (i % 8)))) & 0xFF;
+    data[pos++] = QLatin1Char(hex[byte >> 4]);
+    data[pos++] = QLatin1Char(hex[byte & 0x0F]);
+  }
+  return str;
+}
+
 /*******************************************************************************
  *  Static Methods
  ******************************************************************************/
 
 bool Uuid::isValid(const QString& str) noexcept {
-  // Note: This used to be done using a RegEx, but when profiling and
-  // optimizing the library rescan code we found that a manually unrolled
-  // comparison loop performs much better than the previous RegEx.
-  // See https://github.com/LibrePCB/LibrePCB/pull/651 for more details.
-  if (str.length() != 36) return false;
-
-  // Helper function
-  auto isLowerHex = [](const QChar& chr) {
-    return (chr >= QChar('0') && chr <= QChar('9')) ||
-        (chr >= QChar('a') && chr <= QChar('f'));
-  };
-
-  if (!isLowerHex(str[0])) return false;
-  if (!isLowerHex(str[1])) return false;
-  if (!isLowerHex(str[2])) return false;
-  if (!isLowerHex(str[3])) return false;
-  if (!isLowerHex(str[4])) return false;
-  if (!isLowerHex(str[5])) return false;
-  if (!isLowerHex(str[6])) return false;
-  if (!isLowerHex(str[7])) return false;
-  if (str[8] != QChar('-')) return false;
-  if (!isLowerHex(str[9])) return false;
-  if (!isLowerHex(str[10])) return false;
-  if (!isLowerHex(str[11])) return false;
-  if (!isLowerHex(str[12])) return false;
-  if (str[13] != QChar('-')) return false;
-  if (!isLowerHex(str[14])) return false;
-  if (!isLowerHex(str[15])) return false;
-  if (!isLowerHex(str[16])) return false;
-  if (!isLowerHex(str[17])) return false;
-  if (str[18] != QChar('-')) return false;
-  if (!isLowerHex(str[19])) return false;
-  if (!isLowerHex(str[20])) return false;
-  if (!isLowerHex(str[21])) return false;
-  if (!isLowerHex(str[22])) return false;
-  if (str[23] != QChar('-')) return false;
-  if (!isLowerHex(str[24])) return false;
-  if (!isLowerHex(str[25])) return false;
-  if (!isLowerHex(str[26])) return false;
-  if (!isLowerHex(str[27])) return false;
-  if (!isLowerHex(str[28])) return false;
-  if (!isLowerHex(str[29])) return false;
-  if (!isLowerHex(str[30])) return false;
-  if (!isLowerHex(str[31])) return false;
-  if (!isLowerHex(str[32])) return false;
-  if (!isLowerHex(str[33])) return false;
-  if (!isLowerHex(str[34])) return false;
-  if (!isLowerHex(str[35])) return false;
-
-  // check type of uuid
-  QUuid quuid(str);
-  if (quuid.isNull()) return false;
-  if (quuid.variant() != QUuid::DCE) return false;
-  if (quuid.version() != QUuid::Random) return false;
-
-  return true;
+  quint64 hi, lo;
+  return parse(str.constData(), str.length(), hi, lo);
 }
 
 Uuid Uuid::createRandom() noexcept {
-  QString str =
-      QUuid::createUuid().toString().remove("{").remove("}").toLower();
-  if (isValid(str)) {
-    return Uuid(str);
+  const QByteArray rfc4122 = QUuid::createUuid().toRfc4122();
+  quint64 hi = 0, lo = 0;
+  for (int i = 0; (i < 8) && (rfc4122.size() == 16); ++i) {
+    hi = (hi << 8) | static_cast<quint8>(rfc4122.at(i));
+    lo = (lo << 8) | static_cast<quint8>(rfc4122.at(i + 8));
+  }
+  // Check version 4 (random) and variant DCE, like isValid() does.
+  if (((hi & 0xF000) == 0x4000) && ((lo >> 62) == 0x2)) {
+    return Uuid(hi, lo);
   } else {
     // Calls abort()!
     qFatal("Not able to generate valid random UUID, terminating application!");
@@ -105,8 +88,9 @@ Uuid Uuid::createRandom() noexcept {
 }
 
 Uuid Uuid::fromString(const QString& str) {
-  if (isValid(str)) {
-    return Uuid(str);
+  quint64 hi, lo;
+  if (parse(str.constData(), str.length(), hi, lo)) {
+    return Uuid(hi, lo);
   } else {
     throw RuntimeError(__FILE__, __LINE__,
                        tr("String is not a valid UUID: \"%1\"").arg(str));
@@ -114,13 +98,77 @@ Uuid Uuid::fromString(const QString& str) {
 }
 
 tl::optional<Uuid> Uuid::tryFromString(const QString& str) noexcept {
-  if (isValid(str)) {
-    return Uuid(str);
+  quint64 hi, lo;
+  if (parse(str.constData(), str.length(), hi, lo)) {
+    return Uuid(hi, lo);
   } else {
     return tl::nullopt;
   }
 }
 
+Uuid Uuid::fromUtf8(const QByteArray& str) {
+  quint64 hi, lo;
+  if (parse(str.constData(), str.length(), hi, lo)) {
+    return Uuid(hi, lo);
+  } else {
+    throw RuntimeError(
+        __FILE__, __LINE__,
+        tr("String is not a valid UUID: \"%1\"").arg(QString::fromUtf8(str)));
+  }
+}
+
+tl::optional<Uuid> Uuid::tryFromUtf8(const QByteArray& str) noexcept {
+  quint64 hi, lo;
+  if (parse(str.constData(), str.length(), hi, lo)) {
+    return Uuid(hi, lo);
+  } else {
+    return tl::nullopt;
+  }
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+template <typename T>
+bool Uuid::parse(const T* str, int length, quint64& hi, quint64& lo) noexcept {
+  // Note: This used to be done using a RegEx, but when profiling and
+  // optimizing the library rescan code we found that a manually unrolled
+  // comparison loop performs much better than the previous RegEx.
+  // See https://github.com/LibrePCB/LibrePCB/pull/651 for more details.
+  // Nowadays the hex digits are also decoded in the same pass, so no QUuid
+  // needs to be created anymore to check the version and variant.
+  if (length != 36) return false;
+
+  hi = 0;
+  lo = 0;
+  int nibbles = 0;
+  for (int i = 0; i < 36; ++i) {
+    const ushort chr = charCode(str[i]);
+    if ((i == 8) || (i == 13) || (i == 18) || (i == 23)) {
+      if (chr != '-') return false;
+      continue;
+    }
+    quint64 value;
+    if ((chr >= '0') && (chr <= '9')) {
+      value = chr - '0';
+    } else if ((chr >= 'a') && (chr <= 'f')) {
+      value = chr - 'a' + 10;
+    } else {
+      return false;
+    }
+    quint64& word = (nibbles < 16) ? hi : lo;
+    word = (word << 4) | value;
+    ++nibbles;
+  }
+
+  // check type of uuid (version 4 = random, variant DCE = 0b10xx)
+  if ((hi & 0xF000) != 0x4000) return false;
+  if ((lo >> 62) != 0x2) return false;
+
+  return true;
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -46,6 +46,13 @@ namespace librepcb {
  * (random UUID). Other types and/or versions of UUIDs are considered as
  * invalid. The characters in a UUID are always lowercase.
  *
+ * Internally the UUID is stored as two 64-bit words (big-endian order of the
+ * RFC4122 byte representation), so comparisons and hashing do not need to
+ * touch any strings. The string representation is only created on demand,
+ * e.g. for serialization. Since the words are ordered the same way as the
+ * hexadecimal characters of the string, the comparison operators behave
+ * exactly like comparing the (lowercase) strings.
+ *
  * A valid UUID looks like this: "d79d354b-62bd-4866-996a-78941c575e78"
  *
  * @note This class guarantees that only Uuid objects representing a valid UUID
@@ -71,7 +78,7 @@ public:
    *
    * @param other     Another ::librepcb::Uuid object
    */
-  Uuid(const Uuid& other) noexcept : mUuid(other.mUuid) {}
+  Uuid(const Uuid& other) noexcept : mHi(other.mHi), mLo(other.mLo) {}
 
   /**
    * @brief Destructor
@@ -85,7 +92,7 @@ public:
    *
    * @return The UUID as a string
    */
-  QString toStr() const noexcept { return mUuid; }
+  QString toStr() const noexcept;
 
   //@{
   /**
@@ -93,18 +100,23 @@ public:
    *
    * @param rhs   The other object to compare
    *
-   * @return Result of comparing the UUIDs as strings
+   * @return Result of comparing the UUIDs (same as comparing them as strings)
    */
   Uuid& operator=(const Uuid& rhs) noexcept {
-    mUuid = rhs.mUuid;
+    mHi = rhs.mHi;
+    mLo = rhs.mLo;
     return *this;
   }
-  bool operator==(const Uuid& rhs) const noexcept { return mUuid == rhs.mUuid; }
-  bool operator!=(const Uuid& rhs) const noexcept { return mUuid != rhs.mUuid; }
-  bool operator<(const Uuid& rhs) const noexcept { return mUuid < rhs.mUuid; }
-  bool operator>(const Uuid& rhs) const noexcept { return mUuid > rhs.mUuid; }
-  bool operator<=(const Uuid& rhs) const noexcept { return mUuid <= rhs.mUuid; }
-  bool operator>=(const Uuid& rhs) const noexcept { return mUuid >= rhs.mUuid; }
+  bool operator==(const Uuid& rhs) const noexcept {
+    return (mHi == rhs.mHi) && (mLo == rhs.mLo);
+  }
+  bool operator!=(const Uuid& rhs) const noexcept { return !(*this == rhs); }
+  bool operator<(const Uuid& rhs) const noexcept {
+    return (mHi < rhs.mHi) || ((mHi == rhs.mHi) && (mLo < rhs.mLo));
+  }
+  bool operator>(const Uuid& rhs) const noexcept { return rhs < *this; }
+  bool operator<=(const Uuid& rhs) const noexcept { return !(rhs < *this); }
+  bool operator>=(const Uuid& rhs) const noexcept { return !(*this < rhs); }
   //@}
 
   // Static Methods
@@ -148,16 +160,51 @@ public:
    */
   static tl::optional<Uuid> tryFromString(const QString& str) noexcept;
 
+  /**
+   * @brief Create Uuid from an UTF-8 encoded string
+   *
+   * Same as #fromString(), but parses the bytes directly without converting
+   * them to a QString first.
+   *
+   * @param str           Input string (UTF-8 or Latin-1)
+   *
+   * @return The created Uuid object
+   *
+   * @throws Exception if the string does not contain a valid UUID
+   */
+  static Uuid fromUtf8(const QByteArray& str);
+
+  /**
+   * @brief Try creating a Uuid from an UTF-8 encoded string, returning empty
+   * optional if invalid
+   *
+   * @param str           Input string (UTF-8 or Latin-1)
+   *
+   * @retval Uuid         The created Uuid object if str was valid
+   * @retval tl::nullopt  If str was not a valid UUID
+   */
+  static tl::optional<Uuid> tryFromUtf8(const QByteArray& str) noexcept;
+
 private:  // Methods
   /**
-   * @brief Constructor which creates a Uuid object from a string
+   * @brief Constructor which creates a Uuid object from its binary words
    *
-   * @param str       The uuid as a string (lowercase and without braces)
+   * @param hi        Upper 64 bits (must represent a valid UUID together
+   *                  with lo)
+   * @param lo        Lower 64 bits
    */
-  explicit Uuid(const QString& str) noexcept : mUuid(str) {}
+  Uuid(quint64 hi, quint64 lo) noexcept : mHi(hi), mLo(lo) {}
+
+  template <typename T>
+  static bool parse(const T* str, int length, quint64& hi,
+                    quint64& lo) noexcept;
+
+  friend uint qHash(const Uuid& key, uint seed) noexcept;
 
 private:  // Data
-  QString mUuid;  ///< Guaranteed to always contain a valid UUID
+  // Guaranteed to always represent a valid UUID
+  quint64 mHi;  ///< Bytes 0..7 of the RFC4122 representation
+  quint64 mLo;  ///< Bytes 8..15 of the RFC4122 representation
 };
 
 /*******************************************************************************
@@ -205,14 +252,16 @@ inline QDebug operator<<(QDebug stream, const Uuid& uuid) noexcept {
 }
 
 inline uint qHash(const Uuid& key, uint seed) noexcept {
-  return ::qHash(key.toStr(), seed);
+  // Random UUIDs are already uniformly distributed (except the version and
+  // variant bits), so simply folding both words is good enough.
+  return ::qHash(key.mHi ^ key.mLo, seed);
 }
 
 }  // namespace librepcb
 
 namespace tl {
 inline uint qHash(const optional<librepcb::Uuid>& key, uint seed) noexcept {
-  return ::qHash(key ? key->toStr() : QString(), seed);
+  return key ? qHash(*key, seed) : ::qHash(quint64(0), seed);
 }
 }  // namespace tl
 
@@ -151,10 +151,14 @@ QVector<Path> ClipperHelpers::convert(const ClipperLib::Paths& paths) noexcept {
 }
 
 Path ClipperHelpers::convert(const ClipperLib::Path& path) noexcept {
-  Path p;
+  // Build the vertices in one go (with room for the closing vertex) instead
+  // of adding them one by one to the path, which is faster for large paths.
+  QVector<Vertex> vertices;
+  vertices.reserve(static_cast<int>(path.size()) + 1);
   for (const ClipperLib::IntPoint& point : path) {
-    p.addVertex(convert(point));
+    vertices.append(Vertex(convert(point)));
   }
+  Path p(vertices);
   p.close();
   return p;
 }
@@ -176,19 +180,24 @@ ClipperLib::Paths ClipperHelpers::convert(
 
 ClipperLib::Path ClipperHelpers::convert(
     const Path& path, const PositiveLength& maxArcTolerance) noexcept {
+  const QVector<Vertex>& vertices = path.getVertices();
   ClipperLib::Path p;
-  for (int i = 0; i < path.getVertices().count(); ++i) {
-    const Vertex& v = path.getVertices().at(i);
-    const Vertex& v0 = path.getVertices().at(qMax(i - 1, 0));
-    if ((i == 0) || (v0.getAngle() == 0)) {
-      p.push_back(convert(v.getPos()));
+  // Exact size if there are no arcs. Otherwise the vector grows
+  // geometrically, so don't reserve again per arc (quadratic reallocations).
+  p.reserve(vertices.count());
+  for (int i = 0; i < vertices.count(); ++i) {
+    const Vertex& v = vertices.at(i);
+    if ((i == 0) || (vertices.at(i - 1).getAngle() == 0)) {
+      p.emplace_back(v.getPos().getX().toNm(), v.getPos().getY().toNm());
     } else {
       // approximate arcs by many short straight line segments
-      Path arc = Path::flatArc(v0.getPos(), v.getPos(), v0.getAngle(),
-                               maxArcTolerance);
+      const Vertex& v0 = vertices.at(i - 1);
+      const Path arc = Path::flatArc(v0.getPos(), v.getPos(), v0.getAngle(),
+                                     maxArcTolerance);
+      const QVector<Vertex>& arcVertices = arc.getVertices();
       // skip first point as it is would be a duplicate
-      for (int k = 1; k < arc.getVertices().count(); ++k) {
-        p.push_back(convert(arc.getVertices().at(k).getPos()));
+      for (int k = 1; k < arcVertices.count(); ++k) {
+        p.push_back(convert(arcVertices.at(k).getPos()));
       }
     }
   }
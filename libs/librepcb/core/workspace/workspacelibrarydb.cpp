@@ -92,6 +92,12 @@ WorkspaceLibraryDb::WorkspaceLibraryDb(const FilePath& librariesPath)
   qDebug("Successfully loaded workspace library database.");
 }
 
+WorkspaceLibraryDb::WorkspaceLibraryDb(const FilePath& librariesPath,
+                                       const FilePath& dbFilePath)
+  : QObject(nullptr), mLibrariesPath(librariesPath), mFilePath(dbFilePath) {
+  mDb.reset(new SQLiteDatabase(mFilePath));  // can throw
+}
+
 WorkspaceLibraryDb::~WorkspaceLibraryDb() noexcept {
 }
 
@@ -100,7 +106,7 @@ WorkspaceLibraryDb::~WorkspaceLibraryDb() noexcept {
  ******************************************************************************/
 
 int WorkspaceLibraryDb::getScanProgressPercent() const noexcept {
-  return mLibraryScanner->getProgressPercent();
+  return mLibraryScanner ? mLibraryScanner->getProgressPercent() : 100;
 }
 
 bool WorkspaceLibraryDb::getLibraryMetadata(const FilePath libDir,
@@ -166,7 +172,19 @@ QSet<Uuid> WorkspaceLibraryDb::getComponentDevices(
  ******************************************************************************/
 
 void WorkspaceLibraryDb::startLibraryRescan() noexcept {
-  mLibraryScanner->startScan();
+  if (mLibraryScanner) {
+    mLibraryScanner->startScan();
+  }
+}
+
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+std::unique_ptr<WorkspaceLibraryDb> WorkspaceLibraryDb::openQueryConnection(
+    const FilePath& librariesPath, const FilePath& dbFilePath) {
+  return std::unique_ptr<WorkspaceLibraryDb>(
+      new WorkspaceLibraryDb(librariesPath, dbFilePath));  // can throw
 }
 
 /*******************************************************************************
@@ -29,6 +29,8 @@
 
 #include <QtCore>
 
+#include <memory>
+
 /*******************************************************************************
  *  Namespace / Forward Declarations
  ******************************************************************************/
@@ -73,6 +75,13 @@ public:
 
   // Getters
 
+  /**
+   * @brief Get the path to the workspace libraries directory
+   *
+   * @return Path to the libraries directory
+   */
+  const FilePath& getLibrariesPath() const noexcept { return mLibrariesPath; }
+
   /**
    * @brief Get the file path of the SQLite database
    *
@@ -308,6 +317,27 @@ public:
    */
   void startLibraryRescan() noexcept;
 
+  // Static Methods
+
+  /**
+   * @brief Open an additional, query-only connection to a library database
+   *
+   * Database connections can only be used in the thread which created them.
+   * This method allows to run queries in a worker thread by opening a separate
+   * connection to the same database file. The returned object must only be
+   * used (and destroyed) in the thread which called this method. It never
+   * scans the libraries, thus its scan progress is always 100%.
+   *
+   * @param librariesPath   Path to the workspace libraries directory.
+   * @param dbFilePath      Path to the SQLite database file.
+   *
+   * @return The opened database.
+   *
+   * @throw Exception If the database could not be opened.
+   */
+  static std::unique_ptr<WorkspaceLibraryDb> openQueryConnection(
+      const FilePath& librariesPath, const FilePath& dbFilePath);
+
   // Operator Overloadings
   WorkspaceLibraryDb& operator=(const WorkspaceLibraryDb& rhs) = delete;
 
@@ -320,6 +350,8 @@ signals:
   void scanFinished();
 
 private:
+  WorkspaceLibraryDb(const FilePath& librariesPath, const FilePath& dbFilePath);
+
   // Private Methods
   QMultiMap<Version, FilePath> getAll(const QString& elementsTable,
                                       const tl::optional<Uuid>& uuid,
@@ -31,6 +31,7 @@
 #include "../library/pkg/package.h"
 #include "../library/sym/symbol.h"
 #include "../sqlitedatabase.h"
+#include "../tracer.h"
 #include "../utils/toolbox.h"
 #include "workspacelibrarydbwriter.h"
 
@@ -100,6 +101,7 @@ void WorkspaceLibraryScanner::run() noexcept {
 }
 
 void WorkspaceLibraryScanner::scan() noexcept {
+  const TraceZone traceZone("WorkspaceLibraryScanner::scan");
   try {
     QElapsedTimer timer;
     timer.start();
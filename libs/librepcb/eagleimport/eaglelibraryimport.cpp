@@ -34,6 +34,7 @@
 #include <librepcb/core/utils/tangentpathjoiner.h>
 #include <parseagle/library.h>
 
+#include <QtConcurrent>
 #include <QtCore>
 
 /*******************************************************************************
@@ -54,6 +55,7 @@ EagleLibraryImport::EagleLibraryImport(const FilePath& dstLibFp,
     mVersion(Version::fromString("0.1")),
     mAuthor("EAGLE Import"),
     mKeywords("eagle,import"),
+    mMaxThreadCount(QThread::idealThreadCount()),
     mAbort(false) {
 }
 
@@ -300,18 +302,396 @@ bool EagleLibraryImport::setElementDependent(T& element,
   return false;
 }
 
+template <typename T>
+EagleLibraryImport::ConversionFutures EagleLibraryImport::startConversion(
+    QThreadPool& pool, const QVector<T>& elements,
+    std::function<ConversionResult(const T&)> func) const noexcept {
+  ConversionFutures futures;
+  for (int i = 0; i < elements.count(); ++i) {
+    const T& element = elements.at(i);
+    if (element.checkState == Qt::Unchecked) {
+      futures.append(QFuture<ConversionResult>());
+    } else {
+      futures.append(QtConcurrent::run(
+          &pool, [this, &element, func]() -> ConversionResult {
+            if (mAbort) {
+              return ConversionResult{false, tl::nullopt, {}, {}, {}};
+            }
+            return func(element);
+          }));
+    }
+  }
+  return futures;
+}
+
+template <typename T>
+void EagleLibraryImport::finishConversion(
+    const QVector<T>& elements, ConversionFutures& futures,
+    std::function<void(const T&, const ConversionResult&)> onImported,
+    int& count, int totalCount) noexcept {
+  // Note: Results are processed in the order of the elements (not in the
+  // order they are finished) to get reproducible progress and errors.
+  for (int i = 0; i < elements.count(); ++i) {
+    const T& element = elements.at(i);
+    if (mAbort) {
+      break;
+    }
+    if (element.checkState == Qt::Unchecked) {
+      continue;
+    }
+    emit progressStatus(element.displayName);
+    const ConversionResult result = futures.at(i).result();
+    futures[i] = QFuture<ConversionResult>();  // Release memory.
+    if (!result.processed) {
+      break;
+    }
+    foreach (const QString& msg, result.errors) {
+      raiseImportError(msg);
+    }
+    if (result.uuid) {
+      onImported(element, result);
+    }
+    ++count;
+    emit progressPercent((100 * count) / std::max(totalCount, 1));
+  }
+}
+
+EagleLibraryImport::ConversionResult EagleLibraryImport::convertSymbol(
+    const Symbol& sym) const noexcept {
+  // Note: This method is called from different threads at the same time,
+  //       thus be careful with calling other methods to only call thread-safe
+  //       methods!
+
+  ConversionResult result{true, tl::nullopt, {}, {}, {}};
+  try {
+    auto symbol = std::make_shared<librepcb::Symbol>(
+        Uuid::createRandom(), mVersion, mAuthor,
+        EagleTypeConverter::convertElementName(mNamePrefix + sym.displayName),
+        EagleTypeConverter::convertElementDescription(sym.description),
+        mKeywords);
+    symbol->setCategories(mSymbolCategories);
+    foreach (const auto& obj,
+             convertWires(sym.displayName, sym.symbol->getWires(),
+                          result.errors)) {
+      if (obj->getPath().isClosed()) {
+        obj->setIsGrabArea(true);
+      }
+      symbol->getPolygons().append(obj);
+    }
+    foreach (const auto& obj, sym.symbol->getRectangles()) {
+      tryOrRaiseError(
+          sym.displayName,
+          [&]() {
+            symbol->getPolygons().append(
+                EagleTypeConverter::convertRectangle(obj, true));
+          },
+          result.errors);
+    }
+    foreach (const auto& obj, sym.symbol->getPolygons()) {
+      tryOrRaiseError(
+          sym.displayName,
+          [&]() {
+            symbol->getPolygons().append(
+                EagleTypeConverter::convertPolygon(obj, true));
+          },
+          result.errors);
+    }
+    foreach (const auto& obj, sym.symbol->getCircles()) {
+      tryOrRaiseError(
+          sym.displayName,
+          [&]() {
+            symbol->getCircles().append(
+                EagleTypeConverter::convertCircle(obj, true));
+          },
+          result.errors);
+    }
+    foreach (const auto& obj, sym.symbol->getTexts()) {
+      tryOrRaiseError(
+          sym.displayName,
+          [&]() {
+            symbol->getTexts().append(
+                EagleTypeConverter::convertSchematicText(obj));
+          },
+          result.errors);
+    }
+    foreach (const auto& obj, sym.symbol->getPins()) {
+      tryOrRaiseError(
+          sym.displayName,
+          [&]() {
+            auto pin = EagleTypeConverter::convertSymbolPin(obj);
+            symbol->getPins().append(pin);
+            result.pinsOrPads[obj.getName()] = pin->getUuid();
+          },
+          result.errors);
+    }
+    TransactionalDirectory dir(TransactionalFileSystem::openRW(
+        mDestinationLibraryFp
+            .getPathTo(librepcb::Symbol::getShortElementName())
+            .getPathTo(symbol->getUuid().toStr())));
+    symbol->saveTo(dir);
+    dir.getFileSystem()->save();
+    result.uuid = symbol->getUuid();
+  } catch (const Exception& e) {
+    result.errors.append(formatImportError(
+        sym.displayName,
+        tr("Skipped symbol due to error: %1").arg(e.getMsg())));
+  }
+  return result;
+}
+
+EagleLibraryImport::ConversionResult EagleLibraryImport::convertPackage(
+    const Package& pkg) const noexcept {
+  // Note: This method is called from different threads at the same time,
+  //       thus be careful with calling other methods to only call thread-safe
+  //       methods!
+
+  ConversionResult result{true, tl::nullopt, {}, {}, {}};
+  try {
+    auto package = std::make_shared<librepcb::Package>(
+        Uuid::createRandom(), mVersion, mAuthor,
+        EagleTypeConverter::convertElementName(mNamePrefix + pkg.displayName),
+        EagleTypeConverter::convertElementDescription(pkg.description),
+        mKeywords);
+    package->setCategories(mPackageCategories);
+    auto footprint = std::make_shared<Footprint>(
+        Uuid::createRandom(), ElementName("default"), mKeywords);
+    package->getFootprints().append(footprint);
+    foreach (const auto& obj,
+             convertWires(pkg.displayName, pkg.package->getWires(),
+                          result.errors)) {
+      footprint->getPolygons().append(obj);
+    }
+    foreach (const auto& obj, pkg.package->getRectangles()) {
+      tryOrRaiseError(
+          pkg.displayName,
+          [&]() {
+            footprint->getPolygons().append(
+                EagleTypeConverter::convertRectangle(obj, false));
+          },
+          result.errors);
+    }
+    foreach (const auto& obj, pkg.package->getPolygons()) {
+      tryOrRaiseError(
+          pkg.displayName,
+          [&]() {
+            footprint->getPolygons().append(
+                EagleTypeConverter::convertPolygon(obj, false));
+          },
+          result.errors);
+    }
+    foreach (const auto& obj, pkg.package->getCircles()) {
+      tryOrRaiseError(
+          pkg.displayName,
+          [&]() {
+            footprint->getCircles().append(
+                EagleTypeConverter::convertCircle(obj, false));
+          },
+          result.errors);
+    }
+    foreach (const auto& obj, pkg.package->getTexts()) {
+      tryOrRaiseError(
+          pkg.displayName,
+          [&]() {
+            footprint->getStrokeTexts().append(
+                EagleTypeConverter::convertBoardText(obj));
+          },
+          result.errors);
+    }
+    foreach (const auto& obj, pkg.package->getHoles()) {
+      tryOrRaiseError(
+          pkg.displayName,
+          [&]() {
+            footprint->getHoles().append(EagleTypeConverter::convertHole(obj));
+          },
+          result.errors);
+    }
+    foreach (const auto& obj, pkg.package->getThtPads()) {
+      tryOrRaiseError(
+          pkg.displayName,
+          [&]() {
+            auto pair = EagleTypeConverter::convertThtPad(obj);
+            package->getPads().append(pair.first);
+            footprint->getPads().append(pair.second);
+            result.pinsOrPads[obj.getName()] = pair.first->getUuid();
+          },
+          result.errors);
+    }
+    foreach (const auto& obj, pkg.package->getSmtPads()) {
+      tryOrRaiseError(
+          pkg.displayName,
+          [&]() {
+            auto pair = EagleTypeConverter::convertSmtPad(obj);
+            package->getPads().append(pair.first);
+            footprint->getPads().append(pair.second);
+            result.pinsOrPads[obj.getName()] = pair.first->getUuid();
+          },
+          result.errors);
+    }
+    TransactionalDirectory dir(TransactionalFileSystem::openRW(
+        mDestinationLibraryFp
+            .getPathTo(librepcb::Package::getShortElementName())
+            .getPathTo(package->getUuid().toStr())));
+    package->saveTo(dir);
+    dir.getFileSystem()->save();
+    result.uuid = package->getUuid();
+  } catch (const Exception& e) {
+    result.errors.append(formatImportError(
+        pkg.displayName,
+        tr("Skipped package due to error: %1").arg(e.getMsg())));
+  }
+  return result;
+}
+
+EagleLibraryImport::ConversionResult EagleLibraryImport::convertComponent(
+    const Component& cmp, const ImportedElements& imported) const noexcept {
+  // Note: This method is called from different threads at the same time,
+  //       thus be careful with calling other methods to only call thread-safe
+  //       methods!
+
+  ConversionResult result{true, tl::nullopt, {}, {}, {}};
+  try {
+    auto component = std::make_shared<librepcb::Component>(
+        Uuid::createRandom(), mVersion, mAuthor,
+        EagleTypeConverter::convertElementName(mNamePrefix + cmp.displayName),
+        EagleTypeConverter::convertElementDescription(cmp.description),
+        mKeywords);
+    component->setCategories(mComponentCategories);
+    component->setPrefixes(NormDependentPrefixMap(
+        ComponentPrefix(cmp.deviceSet->getPrefix().trimmed())));
+    component->setDefaultValue("{{ PARTNUMBER or DEVICE }}");
+    auto symbolVariant = std::make_shared<ComponentSymbolVariant>(
+        Uuid::createRandom(), "", ElementName("default"), "");
+    component->getSymbolVariants().append(symbolVariant);
+    QHash<QString, int> pinCount;
+    foreach (const auto& gate, cmp.deviceSet->getGates()) {
+      const QHash<QString, tl::optional<Uuid> > pins =
+          imported.symbolPins.value(gate.getSymbol());
+      for (auto pinIt = pins.constBegin(); pinIt != pins.constEnd(); pinIt++) {
+        pinCount[pinIt.key()]++;
+      }
+    }
+    foreach (const auto& gate, cmp.deviceSet->getGates()) {
+      tl::optional<Uuid> symbolUuid = imported.symbols.value(gate.getSymbol());
+      if (!symbolUuid) {
+        throw RuntimeError(__FILE__, __LINE__,
+                           tr("Dependent symbol \"%1\" not imported.")
+                               .arg(gate.getSymbol()));
+      }
+      auto item = std::make_shared<ComponentSymbolVariantItem>(
+          Uuid::createRandom(), *symbolUuid,
+          EagleTypeConverter::convertPoint(gate.getPosition()), Angle(0), true,
+          EagleTypeConverter::convertGateName(gate.getName()));
+      symbolVariant->getSymbolItems().append(item);
+      const QHash<QString, tl::optional<Uuid> > pins =
+          imported.symbolPins.value(gate.getSymbol());
+      for (auto pinIt = pins.constBegin(); pinIt != pins.constEnd(); pinIt++) {
+        Uuid signalUuid = Uuid::createRandom();
+        QString signalName = pinIt.key();
+        if ((pinCount[signalName] > 1) ||
+            (component->getSignals().contains(signalName))) {
+          // Name conflict -> add prefix to ensure unique signal names.
+          signalName.prepend(*item->getSuffix() % "_");
+        }
+        component->getSignals().append(std::make_shared<ComponentSignal>(
+            signalUuid, EagleTypeConverter::convertPinOrPadName(signalName),
+            SignalRole::passive(), QString(), false, false, false));
+        item->getPinSignalMap().append(
+            std::make_shared<ComponentPinSignalMapItem>(
+                pinIt->value(), signalUuid,
+                CmpSigPinDisplayType::componentSignal()));
+        result.gateSignals[gate.getName()][pinIt.key()] = signalUuid;
+      }
+    }
+    TransactionalDirectory dir(TransactionalFileSystem::openRW(
+        mDestinationLibraryFp
+            .getPathTo(librepcb::Component::getShortElementName())
+            .getPathTo(component->getUuid().toStr())));
+    component->saveTo(dir);
+    dir.getFileSystem()->save();
+    result.uuid = component->getUuid();
+  } catch (const Exception& e) {
+    result.errors.append(formatImportError(
+        cmp.displayName,
+        tr("Skipped component due to error: %1").arg(e.getMsg())));
+  }
+  return result;
+}
+
+EagleLibraryImport::ConversionResult EagleLibraryImport::convertDevice(
+    const Device& dev, const ImportedElements& imported) const noexcept {
+  // Note: This method is called from different threads at the same time,
+  //       thus be careful with calling other methods to only call thread-safe
+  //       methods!
+
+  ConversionResult result{true, tl::nullopt, {}, {}, {}};
+  try {
+    tl::optional<Uuid> componentUuid =
+        imported.components.value(dev.deviceSet->getName());
+    if (!componentUuid) {
+      throw RuntimeError(__FILE__, __LINE__,
+                         tr("Dependent component \"%1\" not imported.")
+                             .arg(dev.componentDisplayName));
+    }
+    tl::optional<Uuid> packageUuid =
+        imported.packages.value(dev.device->getPackage());
+    if (!packageUuid) {
+      throw RuntimeError(__FILE__, __LINE__,
+                         tr("Dependent package \"%1\" not imported.")
+                             .arg(dev.packageDisplayName));
+    }
+    std::unique_ptr<librepcb::Device> device(new librepcb::Device(
+        Uuid::createRandom(), mVersion, mAuthor,
+        EagleTypeConverter::convertElementName(mNamePrefix + dev.displayName),
+        EagleTypeConverter::convertElementDescription(dev.description),
+        mKeywords, *componentUuid, *packageUuid));
+    device->setCategories(mDeviceCategories);
+    const QHash<QString, tl::optional<Uuid> > pads =
+        imported.packagePads.value(dev.device->getPackage());
+    const QHash<QString, QHash<QString, tl::optional<Uuid> > > gateSignals =
+        imported.componentSignals.value(dev.deviceSet->getName());
+    for (auto padIt = pads.constBegin(); padIt != pads.constEnd(); padIt++) {
+      tl::optional<Uuid> signalUuid;
+      foreach (const auto& connection, dev.device->getConnections()) {
+        if (connection.getPads().contains(padIt.key())) {
+          signalUuid = gateSignals.value(connection.getGate())
+                           .value(connection.getPin());
+        }
+      }
+      device->getPadSignalMap().append(
+          std::make_shared<DevicePadSignalMapItem>(padIt->value(),
+                                                   signalUuid));
+    }
+    TransactionalDirectory dir(TransactionalFileSystem::openRW(
+        mDestinationLibraryFp
+            .getPathTo(librepcb::Device::getShortElementName())
+            .getPathTo(device->getUuid().toStr())));
+    device->saveTo(dir);
+    dir.getFileSystem()->save();
+    result.uuid = device->getUuid();
+  } catch (const Exception& e) {
+    result.errors.append(formatImportError(
+        dev.displayName,
+        tr("Skipped device due to error: %1").arg(e.getMsg())));
+  }
+  return result;
+}
+
 QVector<std::shared_ptr<Polygon> > EagleLibraryImport::convertWires(
-    const QString& element, const QList<parseagle::Wire>& wires) {
+    const QString& element, const QList<parseagle::Wire>& wires,
+    QStringList& errors) const {
   QMap<std::pair<GraphicsLayerName, UnsignedLength>,
        QVector<std::shared_ptr<Polygon> > >
       joinablePolygons;
   foreach (const parseagle::Wire& wire, wires) {
-    tryOrRaiseError(element, [&joinablePolygons, &wire]() {
-      auto polygon = EagleTypeConverter::convertWire(wire);
-      auto key =
-          std::make_pair(polygon->getLayerName(), polygon->getLineWidth());
-      joinablePolygons[key].append(polygon);
-    });
+    tryOrRaiseError(
+        element,
+        [&joinablePolygons, &wire]() {
+          auto polygon = EagleTypeConverter::convertWire(wire);
+          auto key =
+              std::make_pair(polygon->getLayerName(), polygon->getLineWidth());
+          joinablePolygons[key].append(polygon);
+        },
+        errors);
   }
 
   QVector<std::shared_ptr<Polygon> > polygons;
@@ -331,17 +711,21 @@ QVector<std::shared_ptr<Polygon> > EagleLibraryImport::convertWires(
 }
 
 void EagleLibraryImport::tryOrRaiseError(const QString& element,
-                                         std::function<void()> func) {
+                                         std::function<void()> func,
+                                         QStringList& errors) {
   try {
     func();
   } catch (const Exception& e) {
-    raiseImportError(element, e.getMsg());
+    errors.append(formatImportError(element, e.getMsg()));
   }
 }
 
-void EagleLibraryImport::raiseImportError(const QString& element,
-                                          const QString& error) noexcept {
-  QString msg = QString("[%1] ").arg(element) % error;
+QString EagleLibraryImport::formatImportError(const QString& element,
+                                              const QString& error) noexcept {
+  return QString("[%1] ").arg(element) % error;
+}
+
+void EagleLibraryImport::raiseImportError(const QString& msg) noexcept {
   mImportErrors.append(msg);
   emit errorOccurred(msg);
 }
@@ -354,296 +738,68 @@ void EagleLibraryImport::run() noexcept {
   int totalCount = getCheckedElementsCount();
   int count = 0;
 
-  QHash<QString, tl::optional<Uuid> > symbolMap;
-  QHash<QString, QHash<QString, tl::optional<Uuid> > > symbolPinMap;
-  foreach (const Symbol& sym, mSymbols) {
-    if (mAbort) {
-      break;
-    }
-    if (sym.checkState == Qt::Unchecked) {
-      continue;
-    }
-    try {
-      emit progressStatus(sym.displayName);
-      auto symbol = std::make_shared<librepcb::Symbol>(
-          Uuid::createRandom(), mVersion, mAuthor,
-          EagleTypeConverter::convertElementName(mNamePrefix + sym.displayName),
-          EagleTypeConverter::convertElementDescription(sym.description),
-          mKeywords);
-      symbol->setCategories(mSymbolCategories);
-      foreach (const auto& obj,
-               convertWires(sym.displayName, sym.symbol->getWires())) {
-        if (obj->getPath().isClosed()) {
-          obj->setIsGrabArea(true);
-        }
-        symbol->getPolygons().append(obj);
-      }
-      foreach (const auto& obj, sym.symbol->getRectangles()) {
-        tryOrRaiseError(sym.displayName, [&]() {
-          symbol->getPolygons().append(
-              EagleTypeConverter::convertRectangle(obj, true));
-        });
-      }
-      foreach (const auto& obj, sym.symbol->getPolygons()) {
-        tryOrRaiseError(sym.displayName, [&]() {
-          symbol->getPolygons().append(
-              EagleTypeConverter::convertPolygon(obj, true));
+  // The elements of each type are converted and written in parallel, but
+  // the dependencies need to be imported first: Symbols and packages have
+  // no dependencies, components depend on symbols and devices depend on
+  // components and packages. The UUIDs of imported elements are only
+  // modified while no jobs are running which read them. Note that the thread
+  // pool must be destroyed before the imported elements since it waits for
+  // all running jobs.
+  ImportedElements imported;
+  QThreadPool pool;
+  pool.setMaxThreadCount(mMaxThreadCount);
+
+  // Symbols & packages.
+  ConversionFutures symbolFutures = startConversion<Symbol>(
+      pool, mSymbols,
+      [this](const Symbol& sym) { return convertSymbol(sym); });
+  ConversionFutures packageFutures = startConversion<Package>(
+      pool, mPackages,
+      [this](const Package& pkg) { return convertPackage(pkg); });
+  finishConversion<Symbol>(
+      mSymbols, symbolFutures,
+      [&imported](const Symbol& sym, const ConversionResult& result) {
+        imported.symbols[sym.symbol->getName()] = result.uuid;
+        imported.symbolPins[sym.symbol->getName()] = result.pinsOrPads;
+      },
+      count, totalCount);
+  finishConversion<Package>(
+      mPackages, packageFutures,
+      [&imported](const Package& pkg, const ConversionResult& result) {
+        imported.packages[pkg.package->getName()] = result.uuid;
+        imported.packagePads[pkg.package->getName()] = result.pinsOrPads;
+      },
+      count, totalCount);
+
+  // Components.
+  if (!mAbort) {
+    ConversionFutures futures = startConversion<Component>(
+        pool, mComponents, [this, &imported](const Component& cmp) {
+          return convertComponent(cmp, imported);
         });
-      }
-      foreach (const auto& obj, sym.symbol->getCircles()) {
-        tryOrRaiseError(sym.displayName, [&]() {
-          symbol->getCircles().append(
-              EagleTypeConverter::convertCircle(obj, true));
-        });
-      }
-      foreach (const auto& obj, sym.symbol->getTexts()) {
-        tryOrRaiseError(sym.displayName, [&]() {
-          symbol->getTexts().append(
-              EagleTypeConverter::convertSchematicText(obj));
-        });
-      }
-      foreach (const auto& obj, sym.symbol->getPins()) {
-        tryOrRaiseError(sym.displayName, [&]() {
-          auto pin = EagleTypeConverter::convertSymbolPin(obj);
-          symbol->getPins().append(pin);
-          symbolPinMap[sym.symbol->getName()][obj.getName()] = pin->getUuid();
-        });
-      }
-      TransactionalDirectory dir(TransactionalFileSystem::openRW(
-          mDestinationLibraryFp
-              .getPathTo(librepcb::Symbol::getShortElementName())
-              .getPathTo(symbol->getUuid().toStr())));
-      symbol->saveTo(dir);
-      dir.getFileSystem()->save();
-      symbolMap[sym.symbol->getName()] = symbol->getUuid();
-    } catch (const Exception& e) {
-      raiseImportError(sym.displayName,
-                       tr("Skipped symbol due to error: %1").arg(e.getMsg()));
-    }
-    ++count;
-    emit progressPercent((100 * count) / std::max(totalCount, 1));
+    finishConversion<Component>(
+        mComponents, futures,
+        [&imported](const Component& cmp, const ConversionResult& result) {
+          imported.components[cmp.deviceSet->getName()] = result.uuid;
+          imported.componentSignals[cmp.deviceSet->getName()] =
+              result.gateSignals;
+        },
+        count, totalCount);
   }
 
-  QHash<QString, tl::optional<Uuid> > packageMap;
-  QHash<QString, QHash<QString, tl::optional<Uuid> > > packagePadMap;
-  foreach (const Package& pkg, mPackages) {
-    if (mAbort) {
-      break;
-    }
-    if (pkg.checkState == Qt::Unchecked) {
-      continue;
-    }
-    try {
-      emit progressStatus(pkg.displayName);
-      auto package = std::make_shared<librepcb::Package>(
-          Uuid::createRandom(), mVersion, mAuthor,
-          EagleTypeConverter::convertElementName(mNamePrefix + pkg.displayName),
-          EagleTypeConverter::convertElementDescription(pkg.description),
-          mKeywords);
-      package->setCategories(mPackageCategories);
-      auto footprint = std::make_shared<Footprint>(
-          Uuid::createRandom(), ElementName("default"), mKeywords);
-      package->getFootprints().append(footprint);
-      foreach (const auto& obj,
-               convertWires(pkg.displayName, pkg.package->getWires())) {
-        footprint->getPolygons().append(obj);
-      }
-      foreach (const auto& obj, pkg.package->getRectangles()) {
-        tryOrRaiseError(pkg.displayName, [&]() {
-          footprint->getPolygons().append(
-              EagleTypeConverter::convertRectangle(obj, false));
-        });
-      }
-      foreach (const auto& obj, pkg.package->getPolygons()) {
-        tryOrRaiseError(pkg.displayName, [&]() {
-          footprint->getPolygons().append(
-              EagleTypeConverter::convertPolygon(obj, false));
-        });
-      }
-      foreach (const auto& obj, pkg.package->getCircles()) {
-        tryOrRaiseError(pkg.displayName, [&]() {
-          footprint->getCircles().append(
-              EagleTypeConverter::convertCircle(obj, false));
-        });
-      }
-      foreach (const auto& obj, pkg.package->getTexts()) {
-        tryOrRaiseError(pkg.displayName, [&]() {
-          footprint->getStrokeTexts().append(
-              EagleTypeConverter::convertBoardText(obj));
-        });
-      }
-      foreach (const auto& obj, pkg.package->getHoles()) {
-        tryOrRaiseError(pkg.displayName, [&]() {
-          footprint->getHoles().append(EagleTypeConverter::convertHole(obj));
-        });
-      }
-      foreach (const auto& obj, pkg.package->getThtPads()) {
-        tryOrRaiseError(pkg.displayName, [&]() {
-          auto pair = EagleTypeConverter::convertThtPad(obj);
-          package->getPads().append(pair.first);
-          footprint->getPads().append(pair.second);
-          packagePadMap[pkg.package->getName()][obj.getName()] =
-              pair.first->getUuid();
-        });
-      }
-      foreach (const auto& obj, pkg.package->getSmtPads()) {
-        tryOrRaiseError(pkg.displayName, [&]() {
-          auto pair = EagleTypeConverter::convertSmtPad(obj);
-          package->getPads().append(pair.first);
-          footprint->getPads().append(pair.second);
-          packagePadMap[pkg.package->getName()][obj.getName()] =
-              pair.first->getUuid();
+  // Devices.
+  if (!mAbort) {
+    ConversionFutures futures = startConversion<Device>(
+        pool, mDevices, [this, &imported](const Device& dev) {
+          return convertDevice(dev, imported);
         });
-      }
-      TransactionalDirectory dir(TransactionalFileSystem::openRW(
-          mDestinationLibraryFp
-              .getPathTo(librepcb::Package::getShortElementName())
-              .getPathTo(package->getUuid().toStr())));
-      package->saveTo(dir);
-      dir.getFileSystem()->save();
-      packageMap[pkg.package->getName()] = package->getUuid();
-    } catch (const Exception& e) {
-      raiseImportError(pkg.displayName,
-                       tr("Skipped package due to error: %1").arg(e.getMsg()));
-    }
-    ++count;
-    emit progressPercent((100 * count) / std::max(totalCount, 1));
-  }
-
-  QHash<QString, tl::optional<Uuid> > componentMap;
-  QHash<QString, QHash<QString, QHash<QString, tl::optional<Uuid> > > >
-      componentSignalMap;
-  foreach (const Component& cmp, mComponents) {
-    if (mAbort) {
-      break;
-    }
-    if (cmp.checkState == Qt::Unchecked) {
-      continue;
-    }
-    try {
-      emit progressStatus(cmp.displayName);
-      auto component = std::make_shared<librepcb::Component>(
-          Uuid::createRandom(), mVersion, mAuthor,
-          EagleTypeConverter::convertElementName(mNamePrefix + cmp.displayName),
-          EagleTypeConverter::convertElementDescription(cmp.description),
-          mKeywords);
-      component->setCategories(mComponentCategories);
-      component->setPrefixes(NormDependentPrefixMap(
-          ComponentPrefix(cmp.deviceSet->getPrefix().trimmed())));
-      component->setDefaultValue("{{ PARTNUMBER or DEVICE }}");
-      auto symbolVariant = std::make_shared<ComponentSymbolVariant>(
-          Uuid::createRandom(), "", ElementName("default"), "");
-      component->getSymbolVariants().append(symbolVariant);
-      QHash<QString, int> pinCount;
-      foreach (const auto& gate, cmp.deviceSet->getGates()) {
-        for (auto pinIt = symbolPinMap[gate.getSymbol()].constBegin();
-             pinIt != symbolPinMap[gate.getSymbol()].constEnd(); pinIt++) {
-          pinCount[pinIt.key()]++;
-        }
-      }
-      foreach (const auto& gate, cmp.deviceSet->getGates()) {
-        tl::optional<Uuid> symbolUuid = symbolMap[gate.getSymbol()];
-        if (!symbolUuid) {
-          throw RuntimeError(__FILE__, __LINE__,
-                             tr("Dependent symbol \"%1\" not imported.")
-                                 .arg(gate.getSymbol()));
-        }
-        auto item = std::make_shared<ComponentSymbolVariantItem>(
-            Uuid::createRandom(), *symbolUuid,
-            EagleTypeConverter::convertPoint(gate.getPosition()), Angle(0),
-            true, EagleTypeConverter::convertGateName(gate.getName()));
-        symbolVariant->getSymbolItems().append(item);
-        for (auto pinIt = symbolPinMap[gate.getSymbol()].constBegin();
-             pinIt != symbolPinMap[gate.getSymbol()].constEnd(); pinIt++) {
-          Uuid signalUuid = Uuid::createRandom();
-          QString signalName = pinIt.key();
-          if ((pinCount[signalName] > 1) ||
-              (component->getSignals().contains(signalName))) {
-            // Name conflict -> add prefix to ensure unique signal names.
-            signalName.prepend(*item->getSuffix() % "_");
-          }
-          component->getSignals().append(std::make_shared<ComponentSignal>(
-              signalUuid, EagleTypeConverter::convertPinOrPadName(signalName),
-              SignalRole::passive(), QString(), false, false, false));
-          item->getPinSignalMap().append(
-              std::make_shared<ComponentPinSignalMapItem>(
-                  pinIt->value(), signalUuid,
-                  CmpSigPinDisplayType::componentSignal()));
-          componentSignalMap[cmp.deviceSet->getName()][gate.getName()]
-                            [pinIt.key()] = signalUuid;
-        }
-      }
-      TransactionalDirectory dir(TransactionalFileSystem::openRW(
-          mDestinationLibraryFp
-              .getPathTo(librepcb::Component::getShortElementName())
-              .getPathTo(component->getUuid().toStr())));
-      component->saveTo(dir);
-      dir.getFileSystem()->save();
-      componentMap[cmp.deviceSet->getName()] = component->getUuid();
-    } catch (const Exception& e) {
-      raiseImportError(
-          cmp.displayName,
-          tr("Skipped component due to error: %1").arg(e.getMsg()));
-    }
-    ++count;
-    emit progressPercent((100 * count) / std::max(totalCount, 1));
+    finishConversion<Device>(
+        mDevices, futures, [](const Device&, const ConversionResult&) {},
+        count, totalCount);
   }
 
-  foreach (const Device& dev, mDevices) {
-    if (mAbort) {
-      break;
-    }
-    if (dev.checkState == Qt::Unchecked) {
-      continue;
-    }
-    try {
-      emit progressStatus(dev.displayName);
-      tl::optional<Uuid> componentUuid = componentMap[dev.deviceSet->getName()];
-      if (!componentUuid) {
-        throw RuntimeError(__FILE__, __LINE__,
-                           tr("Dependent component \"%1\" not imported.")
-                               .arg(dev.componentDisplayName));
-      }
-      tl::optional<Uuid> packageUuid = packageMap[dev.device->getPackage()];
-      if (!packageUuid) {
-        throw RuntimeError(__FILE__, __LINE__,
-                           tr("Dependent package \"%1\" not imported.")
-                               .arg(dev.packageDisplayName));
-      }
-      std::unique_ptr<librepcb::Device> device(new librepcb::Device(
-          Uuid::createRandom(), mVersion, mAuthor,
-          EagleTypeConverter::convertElementName(mNamePrefix + dev.displayName),
-          EagleTypeConverter::convertElementDescription(dev.description),
-          mKeywords, *componentUuid, *packageUuid));
-      device->setCategories(mDeviceCategories);
-      for (auto padIt = packagePadMap[dev.device->getPackage()].constBegin();
-           padIt != packagePadMap[dev.device->getPackage()].constEnd();
-           padIt++) {
-        tl::optional<Uuid> signalUuid;
-        foreach (const auto& connection, dev.device->getConnections()) {
-          if (connection.getPads().contains(padIt.key())) {
-            signalUuid =
-                componentSignalMap[dev.deviceSet->getName()]
-                                  [connection.getGate()][connection.getPin()];
-          }
-        }
-        device->getPadSignalMap().append(
-            std::make_shared<DevicePadSignalMapItem>(padIt->value(),
-                                                     signalUuid));
-      }
-      TransactionalDirectory dir(TransactionalFileSystem::openRW(
-          mDestinationLibraryFp
-              .getPathTo(librepcb::Device::getShortElementName())
-              .getPathTo(device->getUuid().toStr())));
-      device->saveTo(dir);
-      dir.getFileSystem()->save();
-    } catch (const Exception& e) {
-      raiseImportError(dev.displayName,
-                       tr("Skipped device due to error: %1").arg(e.getMsg()));
-    }
-    ++count;
-    emit progressPercent((100 * count) / std::max(totalCount, 1));
-  }
+  // Wait for cancelled jobs before accessing any data again.
+  pool.waitForDone();
 
   emit progressPercent(100);
   emit progressStatus(tr("Finished: %1 of %2 element(s) imported",
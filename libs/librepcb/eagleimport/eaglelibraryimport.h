@@ -26,9 +26,12 @@
 #include <librepcb/core/fileio/filepath.h>
 #include <librepcb/core/types/uuid.h>
 #include <librepcb/core/types/version.h>
+#include <optional/tl/optional.hpp>
 
 #include <QtCore>
 
+#include <atomic>
+#include <functional>
 #include <memory>
 
 /*******************************************************************************
@@ -131,6 +134,18 @@ public:
   void setComponentChecked(const QString& name, bool checked) noexcept;
   void setDeviceChecked(const QString& name, bool checked) noexcept;
 
+  /**
+   * @brief Set the maximum number of elements converted concurrently
+   *
+   * @param count   Maximum number of threads (`1` converts all elements
+   *                sequentially). Defaults to the number of CPU cores.
+   *
+   * @attention Must not be called while the import is running.
+   */
+  void setMaxThreadCount(int count) noexcept {
+    mMaxThreadCount = qMax(count, 1);
+  }
+
   // General Methods
   void reset() noexcept;
   QStringList open(const FilePath& lbr);
@@ -147,6 +162,29 @@ signals:
   void errorOccurred(const QString& error);
   void finished(const QStringList& errors);
 
+private:  // Types
+  /// UUIDs of already imported elements, used to resolve dependencies
+  struct ImportedElements {
+    QHash<QString, tl::optional<Uuid> > symbols;
+    QHash<QString, QHash<QString, tl::optional<Uuid> > > symbolPins;
+    QHash<QString, tl::optional<Uuid> > packages;
+    QHash<QString, QHash<QString, tl::optional<Uuid> > > packagePads;
+    QHash<QString, tl::optional<Uuid> > components;
+    QHash<QString, QHash<QString, QHash<QString, tl::optional<Uuid> > > >
+        componentSignals;
+  };
+
+  /// Result of converting a single element in a worker thread
+  struct ConversionResult {
+    bool processed;  ///< False if skipped due to abort
+    tl::optional<Uuid> uuid;  ///< Set if the element was imported
+    QHash<QString, tl::optional<Uuid> > pinsOrPads;  ///< By EAGLE name
+    QHash<QString, QHash<QString, tl::optional<Uuid> > >
+        gateSignals;  ///< By EAGLE gate name and pin name
+    QStringList errors;  ///< Formatted import error messages
+  };
+  typedef QVector<QFuture<ConversionResult> > ConversionFutures;
+
 private:  // Methods
   template <typename T>
   int getCheckedElementsCount(const QVector<T>& elements) const noexcept;
@@ -156,10 +194,31 @@ private:  // Methods
   void updateDependencies() noexcept;
   template <typename T>
   bool setElementDependent(T& element, bool dependent) noexcept;
+  template <typename T>
+  ConversionFutures startConversion(
+      QThreadPool& pool, const QVector<T>& elements,
+      std::function<ConversionResult(const T&)> func) const noexcept;
+  template <typename T>
+  void finishConversion(const QVector<T>& elements, ConversionFutures& futures,
+                        std::function<void(const T&, const ConversionResult&)>
+                            onImported,
+                        int& count, int totalCount) noexcept;
+  ConversionResult convertSymbol(const Symbol& sym) const noexcept;
+  ConversionResult convertPackage(const Package& pkg) const noexcept;
+  ConversionResult convertComponent(const Component& cmp,
+                                    const ImportedElements& imported) const
+      noexcept;
+  ConversionResult convertDevice(const Device& dev,
+                                 const ImportedElements& imported) const
+      noexcept;
   QVector<std::shared_ptr<Polygon> > convertWires(
-      const QString& element, const QList<parseagle::Wire>& wires);
-  void tryOrRaiseError(const QString& element, std::function<void()> func);
-  void raiseImportError(const QString& element, const QString& error) noexcept;
+      const QString& element, const QList<parseagle::Wire>& wires,
+      QStringList& errors) const;
+  static void tryOrRaiseError(const QString& element,
+                              std::function<void()> func, QStringList& errors);
+  static QString formatImportError(const QString& element,
+                                   const QString& error) noexcept;
+  void raiseImportError(const QString& msg) noexcept;
   void run() noexcept override;
 
 private:  // Data
@@ -173,9 +232,10 @@ private:  // Data
   QSet<Uuid> mPackageCategories;
   QSet<Uuid> mComponentCategories;
   QSet<Uuid> mDeviceCategories;
+  int mMaxThreadCount;
 
   // State
-  bool mAbort;
+  std::atomic<bool> mAbort;
   FilePath mLoadedFilePath;
   QStringList mImportErrors;
 
@@ -78,7 +78,8 @@ ComponentSymbolVariantEditDialog::ComponentSymbolVariantEditDialog(
   mUi->edtDescription->setText(mSymbVar.getDescriptions().getDefaultValue());
   mUi->cbxNorm->setCurrentText(mSymbVar.getNorm());
 
-  // load symbol items
+  // load symbol items (start loading the symbols in background already)
+  mLibraryElementCache->prefetchSymbols(mSymbVar.getAllSymbolUuids());
   mUi->symbolListWidget->setReferences(mWorkspace, *mGraphicsLayerProvider,
                                        mSymbVar.getSymbolItems(),
                                        mLibraryElementCache, nullptr);
@@ -32,6 +32,7 @@
 #include <librepcb/core/library/sym/symbol.h>
 #include <librepcb/core/workspace/workspacelibrarydb.h>
 
+#include <QtConcurrent/QtConcurrent>
 #include <QtCore>
 
 /*******************************************************************************
@@ -44,11 +45,31 @@ namespace editor {
  *  Constructors / Destructor
  ******************************************************************************/
 
-LibraryElementCache::LibraryElementCache(const WorkspaceLibraryDb& db) noexcept
-  : mDb(&db) {
+LibraryElementCache::LibraryElementCache(const WorkspaceLibraryDb& db,
+                                         int maxCost) noexcept
+  : mDb(&db),
+    mThread(QThread::currentThread()),
+    mMutex(),
+    mCache(maxCost),
+    mPendingPrefetches(),
+    mRunningPrefetches(),
+    mPrefetchFinished(),
+    mStatistics(),
+    mAbortPrefetch(false),
+    mPrefetchPool() {
+  resetStatistics();
+
+  // Use only a few threads to not slow down other (more important) tasks.
+  mPrefetchPool.setMaxThreadCount(qMax(QThread::idealThreadCount() / 2, 1));
 }
 
 LibraryElementCache::~LibraryElementCache() noexcept {
+  {
+    QMutexLocker lock(&mMutex);
+    mAbortPrefetch = true;
+  }
+  mPrefetchPool.clear();
+  mPrefetchPool.waitForDone();
 }
 
 /*******************************************************************************
@@ -57,32 +78,112 @@ LibraryElementCache::~LibraryElementCache() noexcept {
 
 std::shared_ptr<const ComponentCategory>
     LibraryElementCache::getComponentCategory(const Uuid& uuid) const noexcept {
-  return getElement(mCmpCat, uuid);
+  return getElement<ComponentCategory>(uuid);
 }
 
 std::shared_ptr<const PackageCategory> LibraryElementCache::getPackageCategory(
     const Uuid& uuid) const noexcept {
-  return getElement(mPkgCat, uuid);
+  return getElement<PackageCategory>(uuid);
 }
 
 std::shared_ptr<const Symbol> LibraryElementCache::getSymbol(
     const Uuid& uuid) const noexcept {
-  return getElement(mSym, uuid);
+  return getElement<Symbol>(uuid);
 }
 
 std::shared_ptr<const Package> LibraryElementCache::getPackage(
     const Uuid& uuid) const noexcept {
-  return getElement(mPkg, uuid);
+  return getElement<Package>(uuid);
 }
 
 std::shared_ptr<const Component> LibraryElementCache::getComponent(
     const Uuid& uuid) const noexcept {
-  return getElement(mCmp, uuid);
+  return getElement<Component>(uuid);
 }
 
 std::shared_ptr<const Device> LibraryElementCache::getDevice(
     const Uuid& uuid) const noexcept {
-  return getElement(mDev, uuid);
+  return getElement<Device>(uuid);
+}
+
+int LibraryElementCache::getMaxCost() const noexcept {
+  QMutexLocker lock(&mMutex);
+  return mCache.maxCost();
+}
+
+LibraryElementCache::Statistics LibraryElementCache::getStatistics() const
+    noexcept {
+  QMutexLocker lock(&mMutex);
+  Statistics stats = mStatistics;
+  stats.elementCount = mCache.count();
+  stats.totalCost = mCache.totalCost();
+  stats.maxCost = mCache.maxCost();
+  return stats;
+}
+
+/*******************************************************************************
+ *  Setters
+ ******************************************************************************/
+
+void LibraryElementCache::setMaxCost(int maxCost) noexcept {
+  QMutexLocker lock(&mMutex);
+  const int countBefore = mCache.count();
+  mCache.setMaxCost(maxCost);
+  mStatistics.evictions += countBefore - mCache.count();
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+void LibraryElementCache::prefetchComponentCategories(
+    const QSet<Uuid>& uuids) const noexcept {
+  prefetchElements<ComponentCategory>(uuids);
+}
+
+void LibraryElementCache::prefetchPackageCategories(
+    const QSet<Uuid>& uuids) const noexcept {
+  prefetchElements<PackageCategory>(uuids);
+}
+
+void LibraryElementCache::prefetchSymbols(const QSet<Uuid>& uuids) const
+    noexcept {
+  prefetchElements<Symbol>(uuids);
+}
+
+void LibraryElementCache::prefetchPackages(const QSet<Uuid>& uuids) const
+    noexcept {
+  prefetchElements<Package>(uuids);
+}
+
+void LibraryElementCache::prefetchComponents(const QSet<Uuid>& uuids) const
+    noexcept {
+  prefetchElements<Component>(uuids);
+}
+
+void LibraryElementCache::prefetchDevices(const QSet<Uuid>& uuids) const
+    noexcept {
+  prefetchElements<Device>(uuids);
+}
+
+void LibraryElementCache::waitForPrefetchFinished() const noexcept {
+  mPrefetchPool.waitForDone();
+}
+
+void LibraryElementCache::resetStatistics() noexcept {
+  QMutexLocker lock(&mMutex);
+  mStatistics.hits = 0;
+  mStatistics.misses = 0;
+  mStatistics.prefetched = 0;
+  mStatistics.evictions = 0;
+  mStatistics.elementCount = 0;
+  mStatistics.totalCost = 0;
+  mStatistics.maxCost = 0;
+}
+
+void LibraryElementCache::clear() noexcept {
+  QMutexLocker lock(&mMutex);
+  mCache.clear();
 }
 
 /*******************************************************************************
@@ -91,15 +192,32 @@ std::shared_ptr<const Device> LibraryElementCache::getDevice(
 
 template <typename T>
 std::shared_ptr<const T> LibraryElementCache::getElement(
-    QHash<Uuid, std::shared_ptr<const T>>& container, const Uuid& uuid) const
-    noexcept {
-  std::shared_ptr<const T> element = container.value(uuid);
-  if ((!element) && mDb) {
+    const Uuid& uuid) const noexcept {
+  Q_ASSERT(QThread::currentThread() == mThread);
+  const Key key = qMakePair(T::getShortElementName(), uuid);
+  {
+    QMutexLocker lock(&mMutex);
+    // If the element is currently being loaded by a prefetch task, wait for
+    // it instead of loading it a second time. But if the task did not start
+    // yet, the element is loaded synchronously to not wait for other tasks.
+    while (mRunningPrefetches.contains(key)) {
+      mPrefetchFinished.wait(&mMutex);
+    }
+    if (Entry* entry = mCache.object(key)) {  // Marks entry as recently used.
+      ++mStatistics.hits;
+      return std::dynamic_pointer_cast<const T>(*entry);
+    }
+    ++mStatistics.misses;
+  }
+
+  std::shared_ptr<const T> element;
+  if (mDb) {
     try {
-      FilePath fp = mDb->getLatest<T>(uuid);
-      element = std::make_shared<T>(std::unique_ptr<TransactionalDirectory>(
-          new TransactionalDirectory(TransactionalFileSystem::openRO(fp))));
-      container.insert(uuid, element);
+      const FilePath fp = mDb->getLatest<T>(uuid);  // can throw
+      element = loadElement<T>(fp);  // can throw
+      const int cost = calcCost(fp);
+      QMutexLocker lock(&mMutex);
+      insertElement(key, element, cost);
     } catch (const Exception& e) {
       qWarning() << "Failed to open library element:" << e.getMsg();
     }
@@ -107,6 +225,106 @@ std::shared_ptr<const T> LibraryElementCache::getElement(
   return element;
 }
 
+template <typename T>
+void LibraryElementCache::prefetchElements(const QSet<Uuid>& uuids) const
+    noexcept {
+  Q_ASSERT(QThread::currentThread() == mThread);
+  if (!mDb) {
+    return;
+  }
+
+  foreach (const Uuid& uuid, uuids) {
+    const Key key = qMakePair(T::getShortElementName(), uuid);
+    {
+      QMutexLocker lock(&mMutex);
+      if (mCache.contains(key) || mPendingPrefetches.contains(key)) {
+        continue;
+      }
+    }
+    try {
+      // Note: The database must only be accessed from its own thread, so
+      // determine the file path here and only load the files in background.
+      const FilePath fp = mDb->getLatest<T>(uuid);  // can throw
+      if (fp.isValid()) {
+        QMutexLocker lock(&mMutex);
+        mPendingPrefetches.insert(key);
+        QtConcurrent::run(&mPrefetchPool, [this, key, fp]() {
+          prefetchElement<T>(key, fp);
+        });
+      }
+    } catch (const Exception&) {
+      // Ignore errors, they will be reported when accessing the element.
+    }
+  }
+}
+
+template <typename T>
+void LibraryElementCache::prefetchElement(const Key& key,
+                                          const FilePath& fp) const noexcept {
+  {
+    QMutexLocker lock(&mMutex);
+    if (mAbortPrefetch || mCache.contains(key)) {
+      mPendingPrefetches.remove(key);
+      return;
+    }
+    mRunningPrefetches.insert(key);
+  }
+
+  try {
+    std::shared_ptr<T> element = loadElement<T>(fp);  // can throw
+    const int cost = calcCost(fp);
+    QMutexLocker lock(&mMutex);
+    if (!mCache.contains(key)) {
+      insertElement(key, element, cost);
+      ++mStatistics.prefetched;
+    }
+  } catch (const Exception&) {
+    // Ignore errors, they will be reported when accessing the element.
+  }
+
+  QMutexLocker lock(&mMutex);
+  mPendingPrefetches.remove(key);
+  mRunningPrefetches.remove(key);
+  mPrefetchFinished.wakeAll();
+}
+
+template <typename T>
+std::shared_ptr<T> LibraryElementCache::loadElement(const FilePath& fp) const {
+  std::shared_ptr<T> element =
+      std::make_shared<T>(std::unique_ptr<TransactionalDirectory>(
+          new TransactionalDirectory(
+              TransactionalFileSystem::openRO(fp))));  // can throw
+
+  // Elements loaded in background must be moved to the thread of the
+  // cache, otherwise they would have the affinity of a pool thread.
+  if (element->thread() != mThread) {
+    element->moveToThread(mThread);
+  }
+  return element;
+}
+
+void LibraryElementCache::insertElement(const Key& key, const Entry& element,
+                                        int cost) const noexcept {
+  // Note: QCache takes ownership of the entry and deletes it on eviction
+  // (i.e. it just drops the reference to the element).
+  const int countBefore = mCache.count() + (mCache.contains(key) ? 0 : 1);
+  mCache.insert(key, new Entry(element), cost);
+  mStatistics.evictions += countBefore - mCache.count();
+}
+
+int LibraryElementCache::calcCost(const FilePath& fp) noexcept {
+  // The memory consumption of a loaded element is roughly proportional to
+  // the size of its files, so use this as an estimate.
+  qint64 size = 0;
+  QDirIterator it(fp.toStr(), QDir::Files | QDir::Hidden,
+                  QDirIterator::Subdirectories);
+  while (it.hasNext()) {
+    it.next();
+    size += it.fileInfo().size();
+  }
+  return static_cast<int>(qBound(qint64(1), size, qint64(INT_MAX)));
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
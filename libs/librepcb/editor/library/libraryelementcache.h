@@ -38,6 +38,7 @@ namespace librepcb {
 class Component;
 class ComponentCategory;
 class Device;
+class LibraryBaseElement;
 class Package;
 class PackageCategory;
 class Symbol;
@@ -51,15 +52,39 @@ namespace editor {
 
 /**
  * @brief Cache for fast access to library elements
+ *
+ * Loaded elements are kept in a least-recently-used cache which is limited
+ * by the approximate memory consumption of the elements (estimated by the
+ * size of their files). Elements which are still referenced somewhere stay
+ * alive even if they got evicted from the cache, they just need to be loaded
+ * again when requested the next time.
+ *
+ * To avoid stalling the UI on first access, elements can be loaded in
+ * background threads in advance with the `prefetch*()` methods.
+ *
+ * @note All methods must be called from the thread which created the cache
+ *       object, only the prefetching itself runs in other threads.
  */
 class LibraryElementCache final {
   Q_DECLARE_TR_FUNCTIONS(LibraryElementCache)
 
 public:
+  // Types
+  struct Statistics {
+    int hits;  ///< Requested elements which were found in the cache
+    int misses;  ///< Requested elements which had to be loaded
+    int prefetched;  ///< Elements loaded in background by prefetching
+    int evictions;  ///< Elements removed from the cache due to size limit
+    int elementCount;  ///< Number of elements currently in the cache
+    int totalCost;  ///< Estimated size of all cached elements [bytes]
+    int maxCost;  ///< Maximum allowed size of the cache [bytes]
+  };
+
   // Constructors / Destructor
   LibraryElementCache() = delete;
   LibraryElementCache(const LibraryElementCache& other) = delete;
-  explicit LibraryElementCache(const WorkspaceLibraryDb& db) noexcept;
+  explicit LibraryElementCache(const WorkspaceLibraryDb& db,
+                               int maxCost = sDefaultMaxCost) noexcept;
   ~LibraryElementCache() noexcept;
 
   // Getters
@@ -72,24 +97,73 @@ public:
   std::shared_ptr<const Component> getComponent(const Uuid& uuid) const
       noexcept;
   std::shared_ptr<const Device> getDevice(const Uuid& uuid) const noexcept;
+  int getMaxCost() const noexcept;
+  Statistics getStatistics() const noexcept;
+
+  // Setters
+  void setMaxCost(int maxCost) noexcept;
+
+  // General Methods
+
+  /**
+   * @brief Load elements in background threads to speed up later access
+   *
+   * Elements which are already cached or currently being prefetched are
+   * skipped. Errors are ignored, they will be reported by the getters
+   * when the element is actually requested.
+   *
+   * @param uuids   UUIDs of the elements to load.
+   */
+  void prefetchComponentCategories(const QSet<Uuid>& uuids) const noexcept;
+  void prefetchPackageCategories(const QSet<Uuid>& uuids) const noexcept;
+  void prefetchSymbols(const QSet<Uuid>& uuids) const noexcept;
+  void prefetchPackages(const QSet<Uuid>& uuids) const noexcept;
+  void prefetchComponents(const QSet<Uuid>& uuids) const noexcept;
+  void prefetchDevices(const QSet<Uuid>& uuids) const noexcept;
+
+  /**
+   * @brief Block until all scheduled prefetch operations are finished
+   */
+  void waitForPrefetchFinished() const noexcept;
+
+  void resetStatistics() noexcept;
+  void clear() noexcept;
 
   // Operator Overloadings
   LibraryElementCache& operator=(const LibraryElementCache& rhs) = delete;
 
+private:  // Types
+  typedef QPair<QString, Uuid> Key;  ///< Element type and UUID
+  typedef std::shared_ptr<const LibraryBaseElement> Entry;
+
 private:  // Methods
   template <typename T>
-  std::shared_ptr<const T> getElement(
-      QHash<Uuid, std::shared_ptr<const T>>& container, const Uuid& uuid) const
+  std::shared_ptr<const T> getElement(const Uuid& uuid) const noexcept;
+  template <typename T>
+  void prefetchElements(const QSet<Uuid>& uuids) const noexcept;
+  template <typename T>
+  void prefetchElement(const Key& key, const FilePath& fp) const noexcept;
+  template <typename T>
+  std::shared_ptr<T> loadElement(const FilePath& fp) const;
+  void insertElement(const Key& key, const Entry& element, int cost) const
       noexcept;
+  static int calcCost(const FilePath& fp) noexcept;
 
 private:  // Data
   QPointer<const WorkspaceLibraryDb> mDb;
-  mutable QHash<Uuid, std::shared_ptr<const ComponentCategory>> mCmpCat;
-  mutable QHash<Uuid, std::shared_ptr<const PackageCategory>> mPkgCat;
-  mutable QHash<Uuid, std::shared_ptr<const Symbol>> mSym;
-  mutable QHash<Uuid, std::shared_ptr<const Package>> mPkg;
-  mutable QHash<Uuid, std::shared_ptr<const Component>> mCmp;
-  mutable QHash<Uuid, std::shared_ptr<const Device>> mDev;
+  QThread* mThread;  ///< The thread which owns the loaded elements
+
+  mutable QMutex mMutex;  ///< Protects all members below
+  mutable QCache<Key, Entry> mCache;
+  mutable QSet<Key> mPendingPrefetches;  ///< Queued or running prefetches
+  mutable QSet<Key> mRunningPrefetches;  ///< Currently loading prefetches
+  mutable QWaitCondition mPrefetchFinished;
+  mutable Statistics mStatistics;
+  mutable bool mAbortPrefetch;
+
+  mutable QThreadPool mPrefetchPool;
+
+  static const int sDefaultMaxCost = 32 * 1024 * 1024;  ///< 32 MiB
 };
 
 /*******************************************************************************
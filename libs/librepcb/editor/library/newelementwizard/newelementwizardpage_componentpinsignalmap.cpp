@@ -73,11 +73,16 @@ int NewElementWizardPage_ComponentPinSignalMap::nextId() const noexcept {
 
 void NewElementWizardPage_ComponentPinSignalMap::initializePage() noexcept {
   QWizardPage::initializePage();
+  // start loading the symbols in background already
+  ComponentSymbolVariant* symbVar =
+      mContext.mComponentSymbolVariants.value(0).get();
+  auto cache = std::make_shared<LibraryElementCache>(
+      mContext.getWorkspace().getLibraryDb());
+  if (symbVar) {
+    cache->prefetchSymbols(symbVar->getAllSymbolUuids());
+  }
   mUi->pinSignalMapEditorWidget->setReferences(
-      mContext.mComponentSymbolVariants.value(0).get(),
-      std::make_shared<LibraryElementCache>(
-          mContext.getWorkspace().getLibraryDb()),
-      &mContext.mComponentSignals, nullptr);
+      symbVar, cache, &mContext.mComponentSignals, nullptr);
 }
 
 void NewElementWizardPage_ComponentPinSignalMap::cleanupPage() noexcept {
@@ -81,11 +81,14 @@ void NewElementWizardPage_ComponentSymbols::initializePage() noexcept {
         std::make_shared<ComponentSymbolVariant>(Uuid::createRandom(), "",
                                                  ElementName("default"), ""));
   }
+  // start loading the symbols in background already
+  auto cache = std::make_shared<LibraryElementCache>(
+      mContext.getWorkspace().getLibraryDb());
+  cache->prefetchSymbols(
+      mContext.mComponentSymbolVariants.value(0)->getAllSymbolUuids());
   mUi->symbolListEditorWidget->setReferences(
       mContext.getWorkspace(), mContext.getLayerProvider(),
-      mContext.mComponentSymbolVariants.value(0)->getSymbolItems(),
-      std::make_shared<LibraryElementCache>(
-          mContext.getWorkspace().getLibraryDb()),
+      mContext.mComponentSymbolVariants.value(0)->getSymbolItems(), cache,
       nullptr);
 }
 
@@ -70,6 +70,8 @@ AddComponentDialog::AddComponentDialog(const WorkspaceLibraryDb& db,
     mCategoryTreeModel(new CategoryTreeModel(
         mDb, mLocaleOrder, CategoryTreeModel::Filter::CmpCatWithComponents)),
     mCurrentSearchTerm(),
+    mSearchThread(new ComponentSearchThread(db)),
+    mSearchDelayTimer(),
     mSelectedComponent(nullptr),
     mSelectedSymbVar(nullptr),
     mSelectedDevice(nullptr),
@@ -86,6 +88,12 @@ AddComponentDialog::AddComponentDialog(const WorkspaceLibraryDb& db,
   mUi->cbxSymbVar->hide();
   connect(mUi->edtSearch, &QLineEdit::textChanged, this,
           &AddComponentDialog::searchEditTextChanged);
+  mSearchDelayTimer.setSingleShot(true);
+  mSearchDelayTimer.setInterval(150);
+  connect(&mSearchDelayTimer, &QTimer::timeout, this,
+          &AddComponentDialog::startSearchInBackground);
+  connect(mSearchThread.data(), &ComponentSearchThread::resultReady, this,
+          &AddComponentDialog::searchResultReady, Qt::QueuedConnection);
   connect(mUi->treeComponents, &QTreeWidget::currentItemChanged, this,
           &AddComponentDialog::treeComponents_currentItemChanged);
   connect(mUi->treeComponents, &QTreeWidget::itemDoubleClicked, this,
@@ -220,10 +228,13 @@ void AddComponentDialog::searchEditTextChanged(const QString& text) noexcept {
   try {
     QModelIndex catIndex = mUi->treeCategories->currentIndex();
     if (text.trimmed().isEmpty() && catIndex.isValid()) {
+      mSearchDelayTimer.stop();
+      mSearchThread->cancel();
       setSelectedCategory(
           Uuid::tryFromString(catIndex.data(Qt::UserRole).toString()));
     } else {
-      searchComponents(text.trimmed());
+      // Don't search on every keystroke, wait until the user stops typing.
+      mSearchDelayTimer.start();
     }
   } catch (const Exception& e) {
     QMessageBox::critical(this, tr("Error"), e.getMsg());
@@ -253,19 +264,13 @@ void AddComponentDialog::treeComponents_currentItemChanged(
       FilePath cmpFp = FilePath(cmpItem->data(0, Qt::UserRole).toString());
       if ((!mSelectedComponent) ||
           (mSelectedComponent->getDirectory().getAbsPath() != cmpFp)) {
-        Component* component = new Component(
-            std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
-                TransactionalFileSystem::openRO(cmpFp))));
-        setSelectedComponent(component);
+        setSelectedComponent(loadElement<Component>(cmpFp));  // can throw
       }
       if (current->parent()) {
         FilePath devFp = FilePath(current->data(0, Qt::UserRole).toString());
         if ((!mSelectedDevice) ||
             (mSelectedDevice->getDirectory().getAbsPath() != devFp)) {
-          Device* device = new Device(std::unique_ptr<TransactionalDirectory>(
-              new TransactionalDirectory(
-                  TransactionalFileSystem::openRO(devFp))));
-          setSelectedDevice(device);
+          setSelectedDevice(loadElement<Device>(devFp));  // can throw
         }
       } else {
         setSelectedDevice(nullptr);
@@ -306,32 +311,72 @@ void AddComponentDialog::cbxSymbVar_currentIndexChanged(int index) noexcept {
 
 void AddComponentDialog::searchComponents(const QString& input,
                                           bool selectFirstResult) {
+  mSearchDelayTimer.stop();
+  mSearchThread->cancel();
+
+  // min. 2 chars to avoid freeze on entering first character due to huge result
+  ComponentSearchThread::Result result;
+  if (input.length() > 1) {
+    result = ComponentSearchThread::search(mDb, input,
+                                           mLocaleOrder);  // can throw
+  }
+  setSearchResult(input, result, selectFirstResult);
+}
+
+void AddComponentDialog::startSearchInBackground() noexcept {
+  const QString input = mUi->edtSearch->text().trimmed();
+  // min. 2 chars to avoid huge results on entering first character
+  if (input.length() > 1) {
+    mSearchThread->startSearch(input, mLocaleOrder);
+  } else {
+    mSearchThread->cancel();
+    try {
+      setSearchResult(input, ComponentSearchThread::Result(), false);
+    } catch (const Exception& e) {
+      QMessageBox::critical(this, tr("Error"), e.getMsg());
+    }
+  }
+}
+
+void AddComponentDialog::searchResultReady() noexcept {
+  QString input;
+  ComponentSearchThread::Result result = mSearchThread->getResult(&input);
+  if (input.isEmpty() || (input != mUi->edtSearch->text().trimmed())) {
+    return;  // Outdated result, search term was modified in the meantime.
+  }
+  try {
+    setSearchResult(input, result, false);
+  } catch (const Exception& e) {
+    QMessageBox::critical(this, tr("Error"), e.getMsg());
+  }
+}
+
+void AddComponentDialog::setSearchResult(
+    const QString& input, const ComponentSearchThread::Result& result,
+    bool selectFirstResult) {
   mCurrentSearchTerm = input;
   setSelectedComponent(nullptr);
   mUi->treeComponents->clear();
 
-  // min. 2 chars to avoid freeze on entering first character due to huge result
-  if (input.length() > 1) {
-    SearchResult result = searchComponentsAndDevices(input);
-    QHashIterator<FilePath, SearchResultComponent> cmpIt(result);
-    while (cmpIt.hasNext()) {
-      cmpIt.next();
-      QTreeWidgetItem* cmpItem = new QTreeWidgetItem(mUi->treeComponents);
-      cmpItem->setText(0, cmpIt.value().name);
-      cmpItem->setData(0, Qt::UserRole, cmpIt.key().toStr());
-      QHashIterator<FilePath, SearchResultDevice> devIt(cmpIt.value().devices);
-      while (devIt.hasNext()) {
-        devIt.next();
-        QTreeWidgetItem* devItem = new QTreeWidgetItem(cmpItem);
-        devItem->setText(0, devIt.value().name);
-        devItem->setData(0, Qt::UserRole, devIt.key().toStr());
-        devItem->setText(1, devIt.value().pkgName);
-        devItem->setTextAlignment(1, Qt::AlignRight);
-      }
-      cmpItem->setText(1, QString("[%1]").arg(cmpIt.value().devices.count()));
-      cmpItem->setTextAlignment(1, Qt::AlignRight);
-      cmpItem->setExpanded(!cmpIt.value().match);
+  QHashIterator<FilePath, ComponentSearchThread::ResultComponent> cmpIt(result);
+  while (cmpIt.hasNext()) {
+    cmpIt.next();
+    QTreeWidgetItem* cmpItem = new QTreeWidgetItem(mUi->treeComponents);
+    cmpItem->setText(0, cmpIt.value().name);
+    cmpItem->setData(0, Qt::UserRole, cmpIt.key().toStr());
+    QHashIterator<FilePath, ComponentSearchThread::ResultDevice> devIt(
+        cmpIt.value().devices);
+    while (devIt.hasNext()) {
+      devIt.next();
+      QTreeWidgetItem* devItem = new QTreeWidgetItem(cmpItem);
+      devItem->setText(0, devIt.value().name);
+      devItem->setData(0, Qt::UserRole, devIt.key().toStr());
+      devItem->setText(1, devIt.value().pkgName);
+      devItem->setTextAlignment(1, Qt::AlignRight);
     }
+    cmpItem->setText(1, QString("[%1]").arg(cmpIt.value().devices.count()));
+    cmpItem->setTextAlignment(1, Qt::AlignRight);
+    cmpItem->setExpanded(!cmpIt.value().match);
   }
 
   mUi->treeComponents->sortByColumn(0, Qt::AscendingOrder);
@@ -348,69 +393,6 @@ void AddComponentDialog::searchComponents(const QString& input,
   }
 }
 
-AddComponentDialog::SearchResult AddComponentDialog::searchComponentsAndDevices(
-    const QString& input) {
-  SearchResult result;
-  // add matching devices and their corresponding components
-  QList<Uuid> devices = mDb.find<Device>(input);  // can throw
-  foreach (const Uuid& devUuid, devices) {
-    FilePath devFp = mDb.getLatest<Device>(devUuid);  // can throw
-    if (!devFp.isValid()) continue;
-    Uuid cmpUuid = Uuid::createRandom();
-    Uuid pkgUuid = Uuid::createRandom();
-    mDb.getDeviceMetadata(devFp, &cmpUuid,
-                          &pkgUuid);  // can throw
-    FilePath cmpFp = mDb.getLatest<Component>(cmpUuid);  // can throw
-    if (!cmpFp.isValid()) continue;
-    FilePath pkgFp = mDb.getLatest<Package>(pkgUuid);  // can throw
-    SearchResultDevice& resDev = result[cmpFp].devices[devFp];
-    resDev.pkgFp = pkgFp;
-    resDev.match = true;
-  }
-
-  // add matching components and all their devices
-  QList<Uuid> components = mDb.find<Component>(input);  // can throw
-  foreach (const Uuid& cmpUuid, components) {
-    FilePath cmpFp = mDb.getLatest<Component>(cmpUuid);  // can throw
-    if (!cmpFp.isValid()) continue;
-    QSet<Uuid> devices = mDb.getComponentDevices(cmpUuid);  // can throw
-    SearchResultComponent& resCmp = result[cmpFp];
-    resCmp.match = true;
-    foreach (const Uuid& devUuid, devices) {
-      FilePath devFp = mDb.getLatest<Device>(devUuid);  // can throw
-      if (!devFp.isValid()) continue;
-      if (resCmp.devices.contains(devFp)) continue;
-      Uuid pkgUuid = Uuid::createRandom();
-      mDb.getDeviceMetadata(devFp, nullptr,
-                            &pkgUuid);  // can throw
-      FilePath pkgFp = mDb.getLatest<Package>(pkgUuid);  // can throw
-      SearchResultDevice& resDev = resCmp.devices[devFp];
-      resDev.pkgFp = pkgFp;
-    }
-  }
-
-  // get name of elements
-  QMutableHashIterator<FilePath, SearchResultComponent> resultIt(result);
-  while (resultIt.hasNext()) {
-    resultIt.next();
-    mDb.getTranslations<Component>(resultIt.key(), mLocaleOrder,
-                                   &resultIt.value().name);
-    QMutableHashIterator<FilePath, SearchResultDevice> devIt(
-        resultIt.value().devices);
-    while (devIt.hasNext()) {
-      devIt.next();
-      mDb.getTranslations<Device>(devIt.key(), mLocaleOrder,
-                                  &devIt.value().name);
-      if (devIt.value().pkgFp.isValid()) {
-        mDb.getTranslations<Package>(devIt.value().pkgFp, mLocaleOrder,
-                                     &devIt.value().pkgName);
-      }
-    }
-  }
-
-  return result;
-}
-
 void AddComponentDialog::setSelectedCategory(
     const tl::optional<Uuid>& categoryUuid) {
   mCurrentSearchTerm.clear();
@@ -461,15 +443,16 @@ void AddComponentDialog::setSelectedCategory(
   mUi->treeComponents->sortByColumn(0, Qt::AscendingOrder);
 }
 
-void AddComponentDialog::setSelectedComponent(const Component* cmp) {
-  if (cmp && (cmp == mSelectedComponent.get())) return;
+void AddComponentDialog::setSelectedComponent(
+    std::shared_ptr<const Component> cmp) {
+  if (cmp && (cmp == mSelectedComponent)) return;
 
   mUi->lblCompName->setText(tr("No component selected"));
   mUi->lblCompDescription->clear();
   mUi->cbxSymbVar->clear();
   setSelectedDevice(nullptr);
   setSelectedSymbVar(nullptr);
-  mSelectedComponent.reset(cmp);
+  mSelectedComponent = cmp;
 
   if (mSelectedComponent) {
     mUi->lblCompName->setText(*cmp->getNames().value(mLocaleOrder));
@@ -506,9 +489,7 @@ void AddComponentDialog::setSelectedSymbVar(
     for (const ComponentSymbolVariantItem& item : symbVar->getSymbolItems()) {
       FilePath symbolFp = mDb.getLatest<Symbol>(item.getSymbolUuid());
       if (!symbolFp.isValid()) continue;  // TODO: show warning
-      auto symbol = std::make_shared<Symbol>(
-          std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
-              TransactionalFileSystem::openRO(symbolFp))));
+      std::shared_ptr<Symbol> symbol = loadElement<Symbol>(symbolFp);
       mPreviewSymbols.append(symbol);
 
       auto graphicsItem = std::make_shared<SymbolGraphicsItem>(
@@ -523,20 +504,18 @@ void AddComponentDialog::setSelectedSymbVar(
   }
 }
 
-void AddComponentDialog::setSelectedDevice(const Device* dev) {
-  if (dev && (dev == mSelectedDevice.data())) return;
+void AddComponentDialog::setSelectedDevice(std::shared_ptr<const Device> dev) {
+  if (dev && (dev == mSelectedDevice)) return;
 
   mUi->lblDeviceName->setText(tr("No device selected"));
   mPreviewFootprintGraphicsItem.reset();
   mSelectedPackage.reset();
-  mSelectedDevice.reset(dev);
+  mSelectedDevice = dev;
 
   if (mSelectedDevice) {
     FilePath pkgFp = mDb.getLatest<Package>(mSelectedDevice->getPackageUuid());
     if (pkgFp.isValid()) {
-      mSelectedPackage.reset(new Package(
-          std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
-              TransactionalFileSystem::openRO(pkgFp)))));
+      mSelectedPackage = loadElement<Package>(pkgFp);
       QString devName = *mSelectedDevice->getNames().value(mLocaleOrder);
       QString pkgName = *mSelectedPackage->getNames().value(mLocaleOrder);
       if (devName.contains(pkgName, Qt::CaseInsensitive)) {
@@ -557,6 +536,19 @@ void AddComponentDialog::setSelectedDevice(const Device* dev) {
   }
 }
 
+template <typename T>
+std::shared_ptr<T> AddComponentDialog::loadElement(const FilePath& fp) const {
+  // Use the element loaded in the background by the search thread, if
+  // available. Otherwise load it now.
+  std::shared_ptr<T> element = mSearchThread->getPreloadedElement<T>(fp);
+  if (!element) {
+    element = std::make_shared<T>(
+        std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
+            TransactionalFileSystem::openRO(fp))));  // can throw
+  }
+  return element;
+}
+
 void AddComponentDialog::accept() noexcept {
   if ((!mSelectedComponent) || (!mSelectedSymbVar)) {
     QMessageBox::information(
@@ -24,6 +24,7 @@
  *  Includes
  ******************************************************************************/
 #include "../workspace/categorytreemodel.h"
+#include "componentsearchthread.h"
 
 #include <librepcb/core/fileio/filepath.h>
 #include <librepcb/core/types/uuid.h>
@@ -66,22 +67,6 @@ class AddComponentDialog;
 class AddComponentDialog final : public QDialog {
   Q_OBJECT
 
-  // Types
-  struct SearchResultDevice {
-    QString name;
-    FilePath pkgFp;
-    QString pkgName;
-    bool match = false;
-  };
-
-  struct SearchResultComponent {
-    QString name;
-    QHash<FilePath, SearchResultDevice> devices;
-    bool match = false;
-  };
-
-  typedef QHash<FilePath, SearchResultComponent> SearchResult;
-
 public:
   // Constructors / Destructor
   explicit AddComponentDialog(const WorkspaceLibraryDb& db,
@@ -127,12 +112,18 @@ private slots:
 private:
   // Private Methods
   void searchComponents(const QString& input, bool selectFirstResult = false);
-  SearchResult searchComponentsAndDevices(const QString& input);
+  void startSearchInBackground() noexcept;
+  void searchResultReady() noexcept;
+  void setSearchResult(const QString& input,
+                       const ComponentSearchThread::Result& result,
+                       bool selectFirstResult);
   void setSelectedCategory(const tl::optional<Uuid>& categoryUuid);
-  void setSelectedComponent(const Component* cmp);
+  void setSelectedComponent(std::shared_ptr<const Component> cmp);
   void setSelectedSymbVar(
       std::shared_ptr<const ComponentSymbolVariant> symbVar);
-  void setSelectedDevice(const Device* dev);
+  void setSelectedDevice(std::shared_ptr<const Device> dev);
+  template <typename T>
+  std::shared_ptr<T> loadElement(const FilePath& fp) const;
   void accept() noexcept;
 
   // General
@@ -145,13 +136,15 @@ private:
   QScopedPointer<DefaultGraphicsLayerProvider> mGraphicsLayerProvider;
   QScopedPointer<CategoryTreeModel> mCategoryTreeModel;
   QString mCurrentSearchTerm;
+  QScopedPointer<ComponentSearchThread> mSearchThread;
+  QTimer mSearchDelayTimer;  ///< Avoids searching on every keystroke
 
   // Attributes
   tl::optional<Uuid> mSelectedCategoryUuid;
   std::shared_ptr<const Component> mSelectedComponent;
   std::shared_ptr<const ComponentSymbolVariant> mSelectedSymbVar;
-  QScopedPointer<const Device> mSelectedDevice;
-  QScopedPointer<Package> mSelectedPackage;
+  std::shared_ptr<const Device> mSelectedDevice;
+  std::shared_ptr<Package> mSelectedPackage;
   QList<std::shared_ptr<Symbol>> mPreviewSymbols;
   QList<std::shared_ptr<SymbolGraphicsItem>> mPreviewSymbolGraphicsItems;
   QScopedPointer<FootprintGraphicsItem> mPreviewFootprintGraphicsItem;
@@ -97,6 +97,8 @@ BoardDesignRuleCheckDialog::BoardDesignRuleCheckDialog(
           &QCheckBox::setChecked);
   connect(mUi->btnSelectAll, &QPushButton::clicked, mUi->cbxMissingConnections,
           &QCheckBox::setChecked);
+  connect(mUi->btnSelectAll, &QPushButton::clicked, mUi->cbxShortCircuits,
+          &QCheckBox::setChecked);
 
   // set options
   mUi->cbxRebuildPlanes->setChecked(options.rebuildPlanes);
@@ -117,6 +119,7 @@ BoardDesignRuleCheckDialog::BoardDesignRuleCheckDialog(
   mUi->cbxCourtyardOffset->setChecked(options.checkCourtyardClearance);
   mUi->edtCourtyardOffset->setValue(options.courtyardOffset);
   mUi->cbxMissingConnections->setChecked(options.checkMissingConnections);
+  mUi->cbxShortCircuits->setChecked(options.checkShortCircuits);
 
   // Load the window geometry.
   QSettings clientSettings;
@@ -156,6 +159,7 @@ BoardDesignRuleCheck::Options BoardDesignRuleCheckDialog::getOptions() const
   options.checkCourtyardClearance = mUi->cbxCourtyardOffset->isChecked();
   options.courtyardOffset = mUi->edtCourtyardOffset->getValue();
   options.checkMissingConnections = mUi->cbxMissingConnections->isChecked();
+  options.checkShortCircuits = mUi->cbxShortCircuits->isChecked();
   return options;
 }
 
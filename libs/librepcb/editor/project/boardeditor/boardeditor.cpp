@@ -107,6 +107,7 @@ BoardEditor::BoardEditor(ProjectEditor& projectEditor, Project& project)
   mUi->graphicsView->setRulerColor(Qt::yellow);
   mUi->graphicsView->setUseOpenGl(
       mProjectEditor.getWorkspace().getSettings().useOpenGl.get());
+  mUi->graphicsView->setUseTileCache(true);  // Boards are expensive to render.
   mUi->graphicsView->setEventHandlerObject(this);
   connect(mUi->graphicsView, &GraphicsView::cursorScenePositionChanged,
           mUi->statusbar, &StatusBar::setAbsoluteCursorPosition);
@@ -1237,11 +1238,11 @@ void BoardEditor::execDesignRulesDialog() noexcept {
                                   "board_editor/design_rules_dialog", this);
     connect(&dialog, &BoardDesignRulesDialog::rulesChanged,
             [&](const BoardDesignRules& rules) {
-              board->getDesignRules() = rules;
+              board->setDesignRules(rules);
               emit board->attributesChanged();
             });
     int result = dialog.exec();
-    board->getDesignRules() = originalRules;  // important hack ;)
+    board->setDesignRules(originalRules);  // important hack ;)
     if (result == QDialog::Accepted) {
       CmdBoardDesignRulesModify* cmd =
           new CmdBoardDesignRulesModify(*board, dialog.getDesignRules());
@@ -202,7 +202,7 @@ void FabricationOutputDialog::btnGenerateClicked() {
     auto cursorScopeGuard = scopeGuard([this]() { unsetCursor(); });
 
     // rebuild planes because they may be outdated!
-    mBoard.rebuildAllPlanes();
+    mBoard.rebuildModifiedPlanes();
 
     // update fabrication output settings if modified
     BoardFabricationOutputSettings s = mBoard.getFabricationOutputSettings();
@@ -226,7 +226,7 @@ void FabricationOutputDialog::btnGenerateClicked() {
     s.setEnableSolderPasteTop(mUi->cbxSolderPasteTop->isChecked());
     s.setEnableSolderPasteBot(mUi->cbxSolderPasteBot->isChecked());
     if (s != mBoard.getFabricationOutputSettings()) {
-      mBoard.getFabricationOutputSettings() = s;  // TODO: use undo command
+      mBoard.setFabricationOutputSettings(s);  // TODO: use undo command
     }
 
     // generate files
@@ -60,12 +60,12 @@ bool CmdBoardDesignRulesModify::performExecute() {
 }
 
 void CmdBoardDesignRulesModify::performUndo() {
-  mBoard.getDesignRules() = mOldRules;
+  mBoard.setDesignRules(mOldRules);
   emit mBoard.attributesChanged();
 }
 
 void CmdBoardDesignRulesModify::performRedo() {
-  mBoard.getDesignRules() = mNewRules;
+  mBoard.setDesignRules(mNewRules);
   emit mBoard.attributesChanged();
 }
 
@@ -171,8 +171,8 @@ void CmdBoardPlaneEdit::performUndo() {
   mPlane.setPriority(mOldPriority);
   mPlane.setKeepOrphans(mOldKeepOrphans);
 
-  // rebuild all planes to see the changes
-  if (mDoRebuildOnChanges) mPlane.getBoard().rebuildAllPlanes();
+  // rebuild affected planes to see the changes
+  if (mDoRebuildOnChanges) mPlane.getBoard().rebuildModifiedPlanes();
 }
 
 void CmdBoardPlaneEdit::performRedo() {
@@ -185,8 +185,8 @@ void CmdBoardPlaneEdit::performRedo() {
   mPlane.setPriority(mNewPriority);
   mPlane.setKeepOrphans(mNewKeepOrphans);
 
-  // rebuild all planes to see the changes
-  if (mDoRebuildOnChanges) mPlane.getBoard().rebuildAllPlanes();
+  // rebuild affected planes to see the changes
+  if (mDoRebuildOnChanges) mPlane.getBoard().rebuildModifiedPlanes();
 }
 
 /*******************************************************************************
@@ -156,6 +156,7 @@ CmdDragSelectedBoardItems::~CmdDragSelectedBoardItems() noexcept {
 
 void CmdDragSelectedBoardItems::snapToGrid() noexcept {
   PositiveLength grid = mBoard.getGridProperties().getInterval();
+  mBoard.beginBatchUpdate();
   foreach (CmdDeviceInstanceEdit* cmd, mDeviceEditCmds) {
     cmd->snapToGrid(grid, true);
   }
@@ -173,6 +174,7 @@ void CmdDragSelectedBoardItems::snapToGrid() noexcept {
     cmd->snapToGrid(grid, true);
   }
   foreach (CmdHoleEdit* cmd, mHoleEditCmds) { cmd->snapToGrid(grid, true); }
+  mBoard.endBatchUpdate();
   mSnappedToGrid = true;
 
   // Force updating airwires immediately as they are important while moving
@@ -192,7 +194,8 @@ void CmdDragSelectedBoardItems::setCurrentPosition(
   }
 
   if (delta != mDeltaPos) {
-    // move selected elements
+    // move selected elements (netlines are updated only once at the end)
+    mBoard.beginBatchUpdate();
     foreach (CmdDeviceInstanceEdit* cmd, mDeviceEditCmds) {
       cmd->translate(delta - mDeltaPos, true);
     }
@@ -214,11 +217,12 @@ void CmdDragSelectedBoardItems::setCurrentPosition(
     foreach (CmdHoleEdit* cmd, mHoleEditCmds) {
       cmd->translate(delta - mDeltaPos, true);
     }
+    mBoard.endBatchUpdate();
     mDeltaPos = delta;
 
-    // Force updating airwires immediately as they are important while moving
-    // items.
-    mBoard.triggerAirWiresRebuild();
+    // Update airwires while moving items as they are important, but not more
+    // often than the screen gets refreshed.
+    mBoard.triggerAirWiresRebuildThrottled();
   }
 }
 
@@ -226,7 +230,8 @@ void CmdDragSelectedBoardItems::rotate(const Angle& angle,
                                        bool aroundItemsCenter) noexcept {
   Point center = (aroundItemsCenter ? mCenterPos : mStartPos) + mDeltaPos;
 
-  // rotate selected elements
+  // rotate selected elements (netlines are updated only once at the end)
+  mBoard.beginBatchUpdate();
   foreach (CmdDeviceInstanceEdit* cmd, mDeviceEditCmds) {
     cmd->rotate(angle, center, true);
   }
@@ -248,6 +253,7 @@ void CmdDragSelectedBoardItems::rotate(const Angle& angle,
   foreach (CmdHoleEdit* cmd, mHoleEditCmds) {
     cmd->rotate(angle, center, true);
   }
+  mBoard.endBatchUpdate();
   mDeltaAngle += angle;
 
   // Force updating airwires immediately as they are important while dragging
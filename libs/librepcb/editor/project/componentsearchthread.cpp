@@ -0,0 +1,334 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "componentsearchthread.h"
+
+#include <librepcb/core/exceptions.h>
+#include <librepcb/core/fileio/transactionalfilesystem.h>
+#include <librepcb/core/library/cmp/component.h>
+#include <librepcb/core/library/dev/device.h>
+#include <librepcb/core/library/pkg/package.h>
+#include <librepcb/core/library/sym/symbol.h>
+#include <librepcb/core/workspace/workspacelibrarydb.h>
+
+#include <QtCore>
+
+#include <algorithm>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace editor {
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+ComponentSearchThread::ComponentSearchThread(const WorkspaceLibraryDb& db,
+                                             QObject* parent) noexcept
+  : QThread(parent),
+    mLibrariesPath(db.getLibrariesPath()),
+    mDbFilePath(db.getFilePath()),
+    mMutex(),
+    mCondition(),
+    mAbort(false),
+    mRequestId(0),
+    mRequestInput(),
+    mRequestLocaleOrder(),
+    mResultInput(),
+    mResult(),
+    mPreloadedElements() {
+}
+
+ComponentSearchThread::~ComponentSearchThread() noexcept {
+  {
+    QMutexLocker lock(&mMutex);
+    mAbort = true;
+    mCondition.wakeAll();
+  }
+  if (!wait(2000)) {
+    qWarning() << "Failed to abort the component search worker thread, trying "
+                  "to terminate it...";
+    terminate();
+    if (!wait(2000)) {
+      qCritical() << "Failed to terminate the component search worker thread!";
+    }
+  }
+}
+
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+ComponentSearchThread::Result ComponentSearchThread::getResult(
+    QString* input) const noexcept {
+  QMutexLocker lock(&mMutex);
+  if (input) {
+    *input = mResultInput;
+  }
+  return mResult;
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+void ComponentSearchThread::startSearch(
+    const QString& input, const QStringList& localeOrder) noexcept {
+  QMutexLocker lock(&mMutex);
+  ++mRequestId;
+  mRequestInput = input;
+  mRequestLocaleOrder = localeOrder;
+  // Elements of previous searches are not needed anymore. Note that elements
+  // still in use are kept alive by their shared pointers.
+  mPreloadedElements.clear();
+  mCondition.wakeAll();
+  lock.unlock();
+
+  if (!isRunning()) {
+    start(QThread::LowPriority);
+  }
+}
+
+void ComponentSearchThread::cancel() noexcept {
+  QMutexLocker lock(&mMutex);
+  ++mRequestId;
+  mRequestInput.clear();
+  mResultInput.clear();
+  mResult.clear();
+}
+
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+ComponentSearchThread::Result ComponentSearchThread::search(
+    const WorkspaceLibraryDb& db, const QString& input,
+    const QStringList& localeOrder, const std::function<bool()>& isCanceled) {
+  auto canceled = [&isCanceled]() { return isCanceled && isCanceled(); };
+
+  Result result;
+  // add matching devices and their corresponding components
+  QList<Uuid> devices = db.find<Device>(input);  // can throw
+  foreach (const Uuid& devUuid, devices) {
+    if (canceled()) return result;
+    FilePath devFp = db.getLatest<Device>(devUuid);  // can throw
+    if (!devFp.isValid()) continue;
+    Uuid cmpUuid = Uuid::createRandom();
+    Uuid pkgUuid = Uuid::createRandom();
+    db.getDeviceMetadata(devFp, &cmpUuid,
+                         &pkgUuid);  // can throw
+    FilePath cmpFp = db.getLatest<Component>(cmpUuid);  // can throw
+    if (!cmpFp.isValid()) continue;
+    FilePath pkgFp = db.getLatest<Package>(pkgUuid);  // can throw
+    ResultDevice& resDev = result[cmpFp].devices[devFp];
+    resDev.pkgFp = pkgFp;
+    resDev.match = true;
+  }
+
+  // add matching components and all their devices
+  QList<Uuid> components = db.find<Component>(input);  // can throw
+  foreach (const Uuid& cmpUuid, components) {
+    if (canceled()) return result;
+    FilePath cmpFp = db.getLatest<Component>(cmpUuid);  // can throw
+    if (!cmpFp.isValid()) continue;
+    QSet<Uuid> devices = db.getComponentDevices(cmpUuid);  // can throw
+    ResultComponent& resCmp = result[cmpFp];
+    resCmp.match = true;
+    foreach (const Uuid& devUuid, devices) {
+      FilePath devFp = db.getLatest<Device>(devUuid);  // can throw
+      if (!devFp.isValid()) continue;
+      if (resCmp.devices.contains(devFp)) continue;
+      Uuid pkgUuid = Uuid::createRandom();
+      db.getDeviceMetadata(devFp, nullptr,
+                           &pkgUuid);  // can throw
+      FilePath pkgFp = db.getLatest<Package>(pkgUuid);  // can throw
+      ResultDevice& resDev = resCmp.devices[devFp];
+      resDev.pkgFp = pkgFp;
+    }
+  }
+
+  // get name of elements
+  QMutableHashIterator<FilePath, ResultComponent> resultIt(result);
+  while (resultIt.hasNext()) {
+    if (canceled()) return result;
+    resultIt.next();
+    db.getTranslations<Component>(resultIt.key(), localeOrder,
+                                  &resultIt.value().name);
+    QMutableHashIterator<FilePath, ResultDevice> devIt(
+        resultIt.value().devices);
+    while (devIt.hasNext()) {
+      devIt.next();
+      db.getTranslations<Device>(devIt.key(), localeOrder,
+                                 &devIt.value().name);
+      if (devIt.value().pkgFp.isValid()) {
+        db.getTranslations<Package>(devIt.value().pkgFp, localeOrder,
+                                    &devIt.value().pkgName);
+      }
+    }
+  }
+
+  return result;
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void ComponentSearchThread::run() noexcept {
+  std::unique_ptr<WorkspaceLibraryDb> db;
+  try {
+    db = WorkspaceLibraryDb::openQueryConnection(mLibrariesPath,
+                                                 mDbFilePath);  // can throw
+  } catch (const Exception& e) {
+    qCritical().noquote() << "Failed to open library database for search:"
+                          << e.getMsg();
+    return;
+  }
+
+  quint64 handledRequestId = 0;
+  forever {
+    QMutexLocker lock(&mMutex);
+    while ((!mAbort) && (mRequestId == handledRequestId)) {
+      mCondition.wait(&mMutex);
+    }
+    if (mAbort) {
+      break;
+    }
+    const quint64 requestId = mRequestId;
+    const QString input = mRequestInput;
+    const QStringList localeOrder = mRequestLocaleOrder;
+    handledRequestId = requestId;
+    lock.unlock();
+    if (input.isEmpty()) {
+      continue;  // canceled by cancel()
+    }
+
+    // A search is superseded as soon as a new one was requested.
+    auto isCanceled = [this, requestId]() {
+      QMutexLocker locker(&mMutex);
+      return mAbort || (mRequestId != requestId);
+    };
+
+    try {
+      Result result = search(*db, input, localeOrder, isCanceled);
+      lock.relock();
+      if (mAbort || (mRequestId != requestId)) {
+        continue;
+      }
+      mResultInput = input;
+      mResult = result;
+      lock.unlock();
+      emit resultReady();
+      preload(*db, result, isCanceled);
+    } catch (const Exception& e) {
+      qCritical().noquote() << "Failed to search in library database:"
+                            << e.getMsg();
+    }
+  }
+}
+
+void ComponentSearchThread::preload(
+    const WorkspaceLibraryDb& db, const Result& result,
+    const std::function<bool()>& isCanceled) noexcept {
+  // Only preload the top results (as they appear in the sorted tree widget)
+  // since the user is most likely to select one of them.
+  QList<FilePath> cmpFps = result.keys();
+  std::sort(cmpFps.begin(), cmpFps.end(),
+            [&result](const FilePath& a, const FilePath& b) {
+              return result[a].name < result[b].name;
+            });
+  cmpFps = cmpFps.mid(0, sPreloadedComponentsCount);
+
+  foreach (const FilePath& cmpFp, cmpFps) {
+    if (isCanceled()) return;
+    try {
+      // The symbols are needed for the component preview.
+      QSet<Uuid> symbolUuids;
+      {
+        std::unique_ptr<Component> cmp(
+            new Component(std::unique_ptr<TransactionalDirectory>(
+                new TransactionalDirectory(
+                    TransactionalFileSystem::openRO(cmpFp)))));  // can throw
+        for (const ComponentSymbolVariant& var : cmp->getSymbolVariants()) {
+          for (const ComponentSymbolVariantItem& item : var.getSymbolItems()) {
+            symbolUuids.insert(item.getSymbolUuid());
+          }
+        }
+        QMutexLocker lock(&mMutex);
+        cmp->moveToThread(thread());
+        mPreloadedElements.insert(cmpFp, std::shared_ptr<Component>(
+                                             cmp.release()));
+      }
+      foreach (const Uuid& uuid, symbolUuids) {
+        if (isCanceled()) return;
+        preloadElement<Symbol>(db.getLatest<Symbol>(uuid));  // can throw
+      }
+
+      // The devices and their packages are needed for the device preview.
+      const ResultComponent& resCmp = result[cmpFp];
+      for (auto it = resCmp.devices.constBegin();
+           it != resCmp.devices.constEnd(); ++it) {
+        if (isCanceled()) return;
+        preloadElement<Device>(it.key());
+        preloadElement<Package>(it.value().pkgFp);
+      }
+    } catch (const Exception& e) {
+      qWarning().noquote() << "Failed to preload library element:"
+                           << e.getMsg();
+    }
+  }
+}
+
+template <typename T>
+void ComponentSearchThread::preloadElement(const FilePath& fp) noexcept {
+  if (!fp.isValid()) {
+    return;
+  }
+  {
+    QMutexLocker lock(&mMutex);
+    if (mPreloadedElements.contains(fp)) {
+      return;
+    }
+  }
+  try {
+    std::unique_ptr<T> element(new T(std::unique_ptr<TransactionalDirectory>(
+        new TransactionalDirectory(
+            TransactionalFileSystem::openRO(fp)))));  // can throw
+    // The element will be used (and destroyed) in the GUI thread, and the
+    // search thread must not keep any reference to it.
+    QMutexLocker lock(&mMutex);
+    element->moveToThread(thread());
+    mPreloadedElements.insert(fp, std::shared_ptr<T>(element.release()));
+  } catch (const Exception& e) {
+    qWarning().noquote() << "Failed to preload library element:"
+                         << e.getMsg();
+  }
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace editor
+}  // namespace librepcb
@@ -0,0 +1,191 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_EDITOR_COMPONENTSEARCHTHREAD_H
+#define LIBREPCB_EDITOR_COMPONENTSEARCHTHREAD_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <librepcb/core/fileio/filepath.h>
+
+#include <QtCore>
+
+#include <functional>
+#include <memory>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+class LibraryBaseElement;
+class WorkspaceLibraryDb;
+
+namespace editor {
+
+/*******************************************************************************
+ *  Class ComponentSearchThread
+ ******************************************************************************/
+
+/**
+ * @brief Searches components and devices in the workspace library in a
+ *        separate thread
+ *
+ * Each call to #startSearch() supersedes the previous search, i.e. a running
+ * search gets canceled and only the result of the latest search is reported
+ * with the #resultReady() signal. Afterwards, the library elements of the top
+ * results (components, devices, packages and symbols) are loaded in the
+ * background so that they can be shown without delay once the user selects
+ * them (see #getPreloadedElement()).
+ *
+ * The thread uses its own connection to the library database since database
+ * connections must not be shared between threads.
+ *
+ * @warning Be very careful with dependencies to other objects as the #run()
+ * method is executed in a separate thread! Keep the number of dependencies as
+ * small as possible and consider thread synchronization and object lifetimes.
+ */
+class ComponentSearchThread final : public QThread {
+  Q_OBJECT
+
+public:
+  // Types
+  struct ResultDevice {
+    QString name;
+    FilePath pkgFp;
+    QString pkgName;
+    bool match = false;
+  };
+
+  struct ResultComponent {
+    QString name;
+    QHash<FilePath, ResultDevice> devices;
+    bool match = false;
+  };
+
+  typedef QHash<FilePath, ResultComponent> Result;
+
+  // Constructors / Destructor
+  ComponentSearchThread() = delete;
+  ComponentSearchThread(const ComponentSearchThread& other) = delete;
+  explicit ComponentSearchThread(const WorkspaceLibraryDb& db,
+                                 QObject* parent = nullptr) noexcept;
+  ~ComponentSearchThread() noexcept;
+
+  // Getters
+
+  /**
+   * @brief Get the result of the latest finished search
+   *
+   * @param input   If not nullptr, the searched term will be written here.
+   *
+   * @return The search result.
+   */
+  Result getResult(QString* input = nullptr) const noexcept;
+
+  /**
+   * @brief Get a library element which was loaded in the background
+   *
+   * @tparam T    Type of the library element.
+   * @param fp    Directory of the library element.
+   *
+   * @return The element, or nullptr if it was not (yet) loaded.
+   */
+  template <typename T>
+  std::shared_ptr<T> getPreloadedElement(const FilePath& fp) const noexcept {
+    QMutexLocker lock(&mMutex);
+    return std::dynamic_pointer_cast<T>(mPreloadedElements.value(fp));
+  }
+
+  // General Methods
+
+  /**
+   * @brief Start a new search, canceling the currently running one
+   *
+   * @param input         The search term.
+   * @param localeOrder   Locale order to use for the names in the result.
+   */
+  void startSearch(const QString& input,
+                   const QStringList& localeOrder) noexcept;
+
+  /**
+   * @brief Cancel the currently running search (if any)
+   */
+  void cancel() noexcept;
+
+  // Static Methods
+
+  /**
+   * @brief Search components and devices in the library database
+   *
+   * @param db            The library database to search in.
+   * @param input         The search term.
+   * @param localeOrder   Locale order to use for the names in the result.
+   * @param isCanceled    If set, this function is called regularly and the
+   *                      search is aborted as soon as it returns true (the
+   *                      returned result is incomplete then).
+   *
+   * @return Matching components and their devices.
+   *
+   * @throw Exception on database errors.
+   */
+  static Result search(const WorkspaceLibraryDb& db, const QString& input,
+                       const QStringList& localeOrder,
+                       const std::function<bool()>& isCanceled = nullptr);
+
+  // Operator Overloadings
+  ComponentSearchThread& operator=(const ComponentSearchThread& rhs) = delete;
+
+signals:
+  void resultReady();
+
+private:  // Methods
+  void run() noexcept override;
+  void preload(const WorkspaceLibraryDb& db, const Result& result,
+               const std::function<bool()>& isCanceled) noexcept;
+  template <typename T>
+  void preloadElement(const FilePath& fp) noexcept;
+
+private:  // Data
+  const FilePath mLibrariesPath;  ///< Path to workspace libraries directory.
+  const FilePath mDbFilePath;  ///< Path to the SQLite database file.
+
+  mutable QMutex mMutex;  ///< Protects all members below.
+  QWaitCondition mCondition;
+  bool mAbort;
+  quint64 mRequestId;  ///< Incremented for each new search.
+  QString mRequestInput;
+  QStringList mRequestLocaleOrder;
+  QString mResultInput;
+  Result mResult;
+  QHash<FilePath, std::shared_ptr<LibraryBaseElement>> mPreloadedElements;
+
+  // Constants
+  static const int sPreloadedComponentsCount = 5;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace editor
+}  // namespace librepcb
+
+#endif
@@ -32,6 +32,7 @@
 
 #include <librepcb/core/application.h>
 #include <librepcb/core/fileio/transactionalfilesystem.h>
+#include <librepcb/core/project/erc/ercmsglist.h>
 #include <librepcb/core/project/project.h>
 #include <librepcb/core/workspace/workspace.h>
 #include <librepcb/core/workspace/workspacesettings.h>
@@ -57,8 +58,13 @@ ProjectEditor::ProjectEditor(Workspace& workspace, Project& project)
     mBoardEditor(nullptr),
     mLastAutosaveStateId(0) {
   try {
+    // All modifications are done by undo commands, so evaluate the ERC only
+    // once after each command instead of after every single change.
+    mProject.getErcMsgList().beginUpdateBatch();
     mUndoStack = new UndoStack();
     mLastAutosaveStateId = mUndoStack->getUniqueStateId();
+    connect(mUndoStack, &UndoStack::stateModified, &mProject.getErcMsgList(),
+            &ErcMsgList::updateScheduledProviders);
 
     // create the whole schematic/board editor GUI inclusive FSM and so on
     mSchematicEditor = new SchematicEditor(*this, mProject);
@@ -71,6 +77,7 @@ ProjectEditor::ProjectEditor(Workspace& workspace, Project& project)
     mSchematicEditor = nullptr;
     delete mUndoStack;
     mUndoStack = nullptr;
+    mProject.getErcMsgList().endUpdateBatch();
     throw;  // ...and rethrow the exception
   }
 
@@ -107,6 +114,7 @@ ProjectEditor::~ProjectEditor() noexcept {
   mSchematicEditor = nullptr;
   delete mUndoStack;
   mUndoStack = nullptr;
+  mProject.getErcMsgList().endUpdateBatch();
 
   // emit "project editor closed" signal
   emit projectEditorClosed();
@@ -255,6 +263,7 @@ bool ProjectEditor::saveProject() noexcept {
     qDebug() << "Save project...";
     mProject.save();  // can throw
     mProject.getDirectory().getFileSystem()->save();  // can throw
+    mProject.saveCache();
     mLastAutosaveStateId = mUndoStack->getUniqueStateId();
 
     // saving was successful --> clean the undo stack
@@ -285,12 +294,34 @@ bool ProjectEditor::autosaveProject() noexcept {
     return false;
   }
 
+  std::shared_ptr<TransactionalFileSystem> fs =
+      mProject.getDirectory().getFileSystem();
+  if (fs->isAutosaveInProgress()) {
+    // the previous autosave is still being written to the disk, so let's try
+    // it again a few seconds later...
+    QTimer::singleShot(10000, this, &ProjectEditor::autosaveProject);
+    return false;
+  }
+
   try {
     qDebug() << "Autosave project...";
     mProject.save();  // can throw
-    mProject.getDirectory().getFileSystem()->autosave();  // can throw
-    mLastAutosaveStateId = mUndoStack->getUniqueStateId();
-    qDebug() << "Successfully autosaved project.";
+    const uint previousStateId = mLastAutosaveStateId;
+    const uint stateId = mUndoStack->getUniqueStateId();
+    QFuture<bool> future = fs->autosaveAsync();  // can throw
+    QFutureWatcher<bool>* watcher = new QFutureWatcher<bool>(this);
+    connect(watcher, &QFutureWatcher<bool>::finished, this,
+            [this, watcher, stateId, previousStateId]() {
+              if (watcher->result()) {
+                qDebug() << "Successfully autosaved project.";
+              } else if (mLastAutosaveStateId == stateId) {
+                // make sure the next autosave is not skipped
+                mLastAutosaveStateId = previousStateId;
+              }
+              watcher->deleteLater();
+            });
+    watcher->setFuture(future);
+    mLastAutosaveStateId = stateId;
     return true;
   } catch (Exception& exc) {
     return false;
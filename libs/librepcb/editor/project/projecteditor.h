@@ -189,9 +189,13 @@ public slots:
   /**
    * @brief Make a automatic backup of the project (save to temporary files)
    *
+   * The project is serialized on the GUI thread, but the files are written
+   * to the disk in the background (see
+   * ::librepcb::TransactionalFileSystem::autosaveAsync()).
+   *
    * @note The whole save procedere is described in @ref doc_project_save.
    *
-   * @return true on success, false on failure
+   * @return true if the autosave was started, false otherwise
    */
   bool autosaveProject() noexcept;
 
@@ -57,7 +57,10 @@ GraphicsView::GraphicsView(QWidget* parent,
     mSceneRectMarker(),
     mOriginCrossVisible(true),
     mUseOpenGl(false),
+    mUseTileCache(false),
     mGrayOut(false),
+    mTileCache(sTileCacheSizeKb),
+    mOverlayItemRects(),
     mSceneCursor(),
     mRulerGauges({
         {1, LengthUnit::millimeters(), " ", Length(100), Length(0)},
@@ -130,6 +133,15 @@ void GraphicsView::setUseOpenGl(bool useOpenGl) noexcept {
   viewport()->grabGesture(Qt::PinchGesture);
 }
 
+void GraphicsView::setUseTileCache(bool useTileCache) noexcept {
+  if (useTileCache != mUseTileCache) {
+    mUseTileCache = useTileCache;
+    mTileCache.clear();
+    connectSceneChanges(mUseTileCache);
+    viewport()->update();
+  }
+}
+
 void GraphicsView::setGrayOut(bool grayOut) noexcept {
   mGrayOut = grayOut;
   setForegroundBrush(foregroundBrush());  // this will repaint the foreground
@@ -143,9 +155,16 @@ void GraphicsView::setGridProperties(
 
 void GraphicsView::setScene(GraphicsScene* scene) noexcept {
   mSceneRectMarker = QRectF();  // clear marker
-  if (mScene) mScene->removeEventFilter(this);
+  if (mScene) {
+    mScene->removeEventFilter(this);
+    connectSceneChanges(false);
+  }
+  mTileCache.clear();
   mScene = scene;
-  if (mScene) mScene->installEventFilter(this);
+  if (mScene) {
+    mScene->installEventFilter(this);
+    connectSceneChanges(mUseTileCache);
+  }
   QGraphicsView::setScene(mScene);
 }
 
@@ -302,6 +321,47 @@ void GraphicsView::zoomAnimationValueChanged(const QVariant& value) noexcept {
     fitInView(value.toRectF(), Qt::KeepAspectRatio);  // zoom smoothly
 }
 
+void GraphicsView::sceneChanged(const QList<QRectF>& region) noexcept {
+  // The scene only reports the changed rects, not the changed items. So to
+  // avoid invalidating tiles when overlay items are changed or moved, ignore
+  // rects which match the old or new bounding rect of any overlay item.
+  // Compare fuzzily since the scene slightly enlarges empty bounding rects.
+  const QVector<QRectF> overlayRects = getOverlayItemRects();
+  const QVector<QRectF> ignoredRects = overlayRects + mOverlayItemRects;
+  auto isOverlayRect = [&ignoredRects](const QRectF& rect) {
+    foreach (const QRectF& r, ignoredRects) {
+      if ((qAbs(r.left() - rect.left()) < 0.001) &&
+          (qAbs(r.top() - rect.top()) < 0.001) &&
+          (qAbs(r.right() - rect.right()) < 0.001) &&
+          (qAbs(r.bottom() - rect.bottom()) < 0.001)) {
+        return true;
+      }
+    }
+    return false;
+  };
+
+  const QRectF sceneRect = mScene->sceneRect();
+  QList<QRectF> rects;
+  foreach (const QRectF& rect, region) {
+    if (rect.contains(sceneRect)) {
+      // The whole scene has been updated (e.g. an item has been removed).
+      mTileCache.clear();
+      rects.clear();
+      break;
+    } else if (!isOverlayRect(rect)) {
+      rects.append(rect);
+    }
+  }
+  invalidateTiles(rects);
+  mOverlayItemRects = overlayRects;
+}
+
+void GraphicsView::sceneOverlayItemChanged(const QRectF& rect) noexcept {
+  // The item has to be added to or removed from the cached tiles.
+  invalidateTiles({rect});
+  viewport()->update();
+}
+
 /*******************************************************************************
  *  Inherited from QGraphicsView
  ******************************************************************************/
@@ -396,6 +456,54 @@ bool GraphicsView::eventFilter(QObject* obj, QEvent* event) {
   return QWidget::eventFilter(obj, event);
 }
 
+void GraphicsView::paintEvent(QPaintEvent* event) {
+  // The tile cache is only used for pure scaling transforms and not while
+  // zooming smoothly, since every intermediate zoom level would require
+  // rendering new tiles (which are then never used again).
+  const QTransform t = viewportTransform();
+  if ((!mUseTileCache) || (!mScene) || (t.type() > QTransform::TxScale) ||
+      (t.m11() != t.m22()) || (t.m11() <= 0) ||
+      (mZoomAnimation->state() == QAbstractAnimation::Running)) {
+    QGraphicsView::paintEvent(event);
+    return;
+  }
+
+  // Tiles are aligned to the scaled scene origin. To draw them at full
+  // device pixels, snap the origin to full device pixels and use this
+  // snapped transform for everything drawn here.
+  const int offsetX = qRound(t.dx());
+  const int offsetY = qRound(t.dy());
+  const QTransform snapped(t.m11(), 0, 0, t.m22(), offsetX, offsetY);
+  const QRect exposedRect = event->rect();
+  const QRectF exposedSceneRect =
+      snapped.inverted().mapRect(QRectF(exposedRect));
+  QPainter painter(viewport());
+  painter.setRenderHints(renderHints());
+
+  // Draw background.
+  painter.setTransform(snapped);
+  drawBackground(&painter, exposedSceneRect);
+
+  // Draw scene items by blitting the cached tiles.
+  painter.resetTransform();
+  const int left = qFloor((exposedRect.left() - offsetX) / qreal(sTileSize));
+  const int right = qFloor((exposedRect.right() - offsetX) / qreal(sTileSize));
+  const int top = qFloor((exposedRect.top() - offsetY) / qreal(sTileSize));
+  const int bottom =
+      qFloor((exposedRect.bottom() - offsetY) / qreal(sTileSize));
+  for (int x = left; x <= right; ++x) {
+    for (int y = top; y <= bottom; ++y) {
+      painter.drawPixmap(x * sTileSize + offsetX, y * sTileSize + offsetY,
+                         getTile(TileKey{t.m11(), x, y}));
+    }
+  }
+
+  // Draw overlay items on top of the tiles, and the foreground on top of them.
+  painter.setTransform(snapped);
+  drawItems(painter, exposedSceneRect, true);
+  drawForeground(&painter, exposedSceneRect);
+}
+
 void GraphicsView::drawBackground(QPainter* painter, const QRectF& rect) {
   QPen gridPen(Qt::gray);
   gridPen.setCosmetic(true);
@@ -597,6 +705,114 @@ void GraphicsView::drawForeground(QPainter* painter, const QRectF& rect) {
   }
 }
 
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void GraphicsView::connectSceneChanges(bool connectChanges) noexcept {
+  if (!mScene) return;
+  // Note: Connecting to QGraphicsScene::changed() makes the scene
+  // reporting all changes through this signal, so only do it if needed.
+  if (connectChanges) {
+    connect(mScene, &QGraphicsScene::changed, this,
+            &GraphicsView::sceneChanged);
+    connect(mScene, &GraphicsScene::overlayItemChanged, this,
+            &GraphicsView::sceneOverlayItemChanged);
+  } else {
+    disconnect(mScene, &QGraphicsScene::changed, this,
+               &GraphicsView::sceneChanged);
+    disconnect(mScene, &GraphicsScene::overlayItemChanged, this,
+               &GraphicsView::sceneOverlayItemChanged);
+  }
+  mOverlayItemRects = getOverlayItemRects();
+}
+
+QVector<QRectF> GraphicsView::getOverlayItemRects() const noexcept {
+  QVector<QRectF> rects;
+  if (mScene) {
+    QList<const QGraphicsItem*> items = mScene->getOverlayItems().values();
+    while (!items.isEmpty()) {
+      const QGraphicsItem* item = items.takeLast();
+      // Same rect as reported by QGraphicsScene::changed().
+      rects.append(item->sceneTransform().mapRect(item->boundingRect()));
+      foreach (const QGraphicsItem* child, item->childItems()) {
+        items.append(child);
+      }
+    }
+  }
+  return rects;
+}
+
+void GraphicsView::invalidateTiles(const QList<QRectF>& rects) noexcept {
+  if (rects.isEmpty()) return;
+  foreach (const TileKey& key, mTileCache.keys()) {
+    // Add a margin of one pixel to take antialiasing into account.
+    const qreal margin = 1 / key.scale;
+    const QRectF tileRect =
+        getTileSceneRect(key).adjusted(-margin, -margin, margin, margin);
+    foreach (const QRectF& rect, rects) {
+      if (tileRect.intersects(rect)) {
+        mTileCache.remove(key);
+        break;
+      }
+    }
+  }
+}
+
+QRectF GraphicsView::getTileSceneRect(const TileKey& key) const noexcept {
+  const qreal size = sTileSize / key.scale;
+  return QRectF(key.x * size, key.y * size, size, size);
+}
+
+const QPixmap& GraphicsView::getTile(const TileKey& key) noexcept {
+  if (QPixmap* pixmap = mTileCache.object(key)) {
+    return *pixmap;
+  }
+
+  const int dpr = viewport()->devicePixelRatio();
+  const int sizePx = sTileSize * dpr;
+  QScopedPointer<QPixmap> pixmap(new QPixmap(sizePx, sizePx));
+  pixmap->setDevicePixelRatio(dpr);
+  pixmap->fill(Qt::transparent);
+  {
+    QPainter painter(pixmap.data());
+    painter.setRenderHints(renderHints());
+    painter.setTransform(QTransform(key.scale, 0, 0, key.scale,
+                                    -key.x * sTileSize, -key.y * sTileSize));
+    drawItems(painter, getTileSceneRect(key), false);
+  }
+  const QPixmap* tile = pixmap.data();
+  mTileCache.insert(key, pixmap.take(), (sizePx * sizePx * 4) / 1024);
+  return *tile;
+}
+
+void GraphicsView::drawItems(QPainter& painter, const QRectF& rect,
+                             bool overlay) noexcept {
+  // Note: QGraphicsScene::render() cannot skip items, so the items are
+  // painted manually. Only simple items are supported, i.e. no opacity
+  // effects, clipping or transformation-ignoring items.
+  QStyleOptionGraphicsItem option;
+  foreach (QGraphicsItem* item,
+           mScene->items(rect, Qt::IntersectsItemBoundingRect,
+                         Qt::AscendingOrder)) {
+    if ((!item->isVisible()) ||
+        (item->flags().testFlag(QGraphicsItem::ItemHasNoContents)) ||
+        (mScene->isOverlayItem(*item) != overlay)) {
+      continue;
+    }
+    option.state = QStyle::State_None;
+    if (item->isEnabled()) option.state |= QStyle::State_Enabled;
+    if (item->isSelected()) option.state |= QStyle::State_Selected;
+    option.exposedRect = item->boundingRect();
+    option.rect = option.exposedRect.toAlignedRect();
+    painter.save();
+    painter.setTransform(item->sceneTransform(), true);
+    painter.setOpacity(item->effectiveOpacity());
+    item->paint(&painter, &option, nullptr);
+    painter.restore();
+  }
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
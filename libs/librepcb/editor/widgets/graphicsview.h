@@ -71,12 +71,27 @@ public:
   GraphicsScene* getScene() const noexcept { return mScene; }
   QRectF getVisibleSceneRect() const noexcept;
   bool getUseOpenGl() const noexcept { return mUseOpenGl; }
+  bool getUseTileCache() const noexcept { return mUseTileCache; }
   const GridProperties& getGridProperties() const noexcept {
     return *mGridProperties;
   }
 
   // Setters
   void setUseOpenGl(bool useOpenGl) noexcept;
+
+  /**
+   * @brief Enable or disable the tile cache for the scene items
+   *
+   * If enabled, the scene items are rendered into pixmap tiles which are
+   * cached for each zoom level, so panning and repainting only need to blit
+   * the cached tiles. Tiles are re-rendered only if the scene reports changes
+   * within their area. Overlay items (see
+   * ::librepcb::GraphicsScene::setOverlayItem()) are not cached but drawn
+   * on top of the tiles, so dragging them around does not invalidate tiles.
+   *
+   * @param useTileCache  Whether to use the tile cache or not.
+   */
+  void setUseTileCache(bool useTileCache) noexcept;
   void setGrayOut(bool grayOut) noexcept;
   void setGridProperties(const GridProperties& properties) noexcept;
   void setScene(GraphicsScene* scene) noexcept;
@@ -133,14 +148,40 @@ private slots:
 
   // Private Slots
   void zoomAnimationValueChanged(const QVariant& value) noexcept;
+  void sceneChanged(const QList<QRectF>& region) noexcept;
+  void sceneOverlayItemChanged(const QRectF& rect) noexcept;
 
 private:
+  // Types
+  struct TileKey {
+    qreal scale;
+    int x;
+    int y;
+
+    bool operator==(const TileKey& rhs) const noexcept {
+      return (scale == rhs.scale) && (x == rhs.x) && (y == rhs.y);
+    }
+    friend uint qHash(const TileKey& key, uint seed = 0) noexcept {
+      return ::qHash(key.scale, seed) ^ ::qHash(key.x, seed) ^
+          ::qHash(key.y << 16, seed);
+    }
+  };
+
   // Inherited Methods
   void wheelEvent(QWheelEvent* event);
   bool eventFilter(QObject* obj, QEvent* event);
+  void paintEvent(QPaintEvent* event);
   void drawBackground(QPainter* painter, const QRectF& rect);
   void drawForeground(QPainter* painter, const QRectF& rect);
 
+  // Private Methods
+  void connectSceneChanges(bool connectChanges) noexcept;
+  QVector<QRectF> getOverlayItemRects() const noexcept;
+  void invalidateTiles(const QList<QRectF>& rects) noexcept;
+  QRectF getTileSceneRect(const TileKey& key) const noexcept;
+  const QPixmap& getTile(const TileKey& key) noexcept;
+  void drawItems(QPainter& painter, const QRectF& rect, bool overlay) noexcept;
+
   // General Attributes
   QScopedPointer<QLabel> mOverlayLabel;
   IF_GraphicsViewEventHandler* mEventHandlerObject;
@@ -150,8 +191,15 @@ private:
   QRectF mSceneRectMarker;
   bool mOriginCrossVisible;
   bool mUseOpenGl;
+  bool mUseTileCache;
   bool mGrayOut;
 
+  /// Rendered scene items, cost is the pixmap size in kilobytes
+  QCache<TileKey, QPixmap> mTileCache;
+
+  /// Scene rects of all overlay items when the scene was changed last time
+  QVector<QRectF> mOverlayItemRects;
+
   /// If not nullopt, a cursor will be shown at the given position
   tl::optional<std::pair<Point, CursorOptions>> mSceneCursor;
 
@@ -173,6 +221,8 @@ private:
 
   // Static Variables
   static constexpr qreal sZoomStepFactor = 1.3;
+  static constexpr int sTileSize = 256;  ///< Tile size in device pixels
+  static constexpr int sTileCacheSizeKb = 128 * 1024;
 };
 
 /*******************************************************************************
@@ -0,0 +1,80 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "benchmarkhelpers.h"
+
+#include <librepcb/core/exceptions.h>
+#include <librepcb/core/fileio/transactionaldirectory.h>
+#include <librepcb/core/fileio/transactionalfilesystem.h>
+#include <librepcb/core/project/board/board.h>
+#include <librepcb/core/project/project.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+std::unique_ptr<Project> BenchmarkHelpers::openProject(const QString& name) {
+  FilePath projectFp(QString(TEST_DATA_DIR) % "/projects/" % name %
+                     "/project.lpp");
+  std::shared_ptr<TransactionalFileSystem> projectFs =
+      TransactionalFileSystem::openRO(projectFp.getParentDir());  // can throw
+  return std::unique_ptr<Project>(
+      new Project(std::unique_ptr<TransactionalDirectory>(
+                      new TransactionalDirectory(projectFs)),
+                  projectFp.getFilename()));  // can throw
+}
+
+Board& BenchmarkHelpers::getFirstBoard(Project& project) {
+  if (project.getBoards().isEmpty()) {
+    throw LogicError(__FILE__, __LINE__, "The project contains no board.");
+  }
+  return *project.getBoards().first();
+}
+
+void BenchmarkHelpers::runWithProject(
+    ::benchmark::State& state, const QString& projectName,
+    const std::function<std::function<void()>(Project&)>& setup) noexcept {
+  try {
+    std::unique_ptr<Project> project = openProject(projectName);  // can throw
+    const std::function<void()> function = setup(*project);  // can throw
+    while (state.KeepRunning()) {
+      function();  // can throw
+    }
+  } catch (const Exception& e) {
+    state.SkipWithError(qPrintable(e.getMsg()));
+  }
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
@@ -0,0 +1,106 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BENCHMARKS_BENCHMARKHELPERS_H
+#define BENCHMARKS_BENCHMARKHELPERS_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <benchmark/benchmark.h>
+
+#include <QtCore>
+
+#include <functional>
+#include <memory>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+class Board;
+class Project;
+
+namespace benchmarks {
+
+/*******************************************************************************
+ *  BenchmarkHelpers Class
+ ******************************************************************************/
+
+/**
+ * @brief The BenchmarkHelpers class provides some helper methods useful in
+ *        benchmarks
+ */
+class BenchmarkHelpers {
+public:
+  // Constructors / Destructor
+  BenchmarkHelpers() = delete;
+  BenchmarkHelpers(const BenchmarkHelpers& other) = delete;
+  ~BenchmarkHelpers() = delete;
+
+  // Operator Overloadings
+  BenchmarkHelpers& operator=(const BenchmarkHelpers& rhs) = delete;
+
+  // Static Methods
+
+  /**
+   * @brief Open a project from the test data directory (read-only)
+   *
+   * @param name    Name of the project directory within "tests/data/projects",
+   *                e.g. "Gerber Test".
+   * @return The opened project.
+   * @throw Exception if the project could not be opened.
+   */
+  static std::unique_ptr<Project> openProject(const QString& name);
+
+  /**
+   * @brief Get the first board of a project
+   *
+   * @param project   The project to get the board from.
+   * @return The first board of the project.
+   * @throw Exception if the project does not contain any board.
+   */
+  static Board& getFirstBoard(Project& project);
+
+  /**
+   * @brief Run a benchmark on a project from the test data directory
+   *
+   * Opens the project and passes it to the setup function, which is not
+   * measured and returns the function to measure. That function is then
+   * called once per benchmark iteration. If any of these steps throws an
+   * exception, the benchmark is skipped with the error message.
+   *
+   * @param state         The benchmark state.
+   * @param projectName   See #openProject().
+   * @param setup         Setup function returning the function to measure.
+   */
+  static void runWithProject(
+      ::benchmark::State& state, const QString& projectName,
+      const std::function<std::function<void()>(Project&)>& setup) noexcept;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
+
+#endif
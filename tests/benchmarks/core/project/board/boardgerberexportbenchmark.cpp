@@ -0,0 +1,67 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../../../benchmarkhelpers.h"
+
+#include <benchmark/benchmark.h>
+#include <librepcb/core/exceptions.h>
+#include <librepcb/core/fileio/fileutils.h>
+#include <librepcb/core/project/board/board.h>
+#include <librepcb/core/project/board/boardfabricationoutputsettings.h>
+#include <librepcb/core/project/board/boardgerberexport.h>
+#include <librepcb/core/project/project.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+/*******************************************************************************
+ *  Benchmarks
+ ******************************************************************************/
+
+static void BoardGerberExportPcbLayers(::benchmark::State& state) {
+  const FilePath outputDir = FilePath::getRandomTempPath();
+  BenchmarkHelpers::runWithProject(
+      state, "Gerber Test", [&outputDir](Project& project) {
+        const Board& board = BenchmarkHelpers::getFirstBoard(project);
+        BoardFabricationOutputSettings config =
+            board.getFabricationOutputSettings();
+        config.setOutputBasePath(outputDir.toStr() % "/{{PROJECT}}");
+        return [&board, config]() {
+          BoardGerberExport grbExport(board);
+          grbExport.exportPcbLayers(config);  // can throw
+        };
+      });
+  QDir(outputDir.toStr()).removeRecursively();
+}
+BENCHMARK(BoardGerberExportPcbLayers)->Unit(::benchmark::kMillisecond);
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
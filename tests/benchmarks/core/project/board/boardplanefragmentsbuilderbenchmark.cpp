@@ -0,0 +1,64 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../../../benchmarkhelpers.h"
+
+#include <benchmark/benchmark.h>
+#include <librepcb/core/exceptions.h>
+#include <librepcb/core/project/board/board.h>
+#include <librepcb/core/project/board/boardplanefragmentsbuilder.h>
+#include <librepcb/core/project/board/items/bi_plane.h>
+#include <librepcb/core/project/project.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+/*******************************************************************************
+ *  Benchmarks
+ ******************************************************************************/
+
+static void BoardPlaneFragmentsBuilderBuild(::benchmark::State& state) {
+  BenchmarkHelpers::runWithProject(
+      state, "Nested Planes", [](Project& project) {
+        Board& board = BenchmarkHelpers::getFirstBoard(project);
+        return [&board]() {
+          foreach (BI_Plane* plane, board.getPlanes()) {
+            BoardPlaneFragmentsBuilder builder(*plane);
+            QVector<Path> fragments = builder.buildFragments();
+            ::benchmark::DoNotOptimize(fragments);
+          }
+        };
+      });
+}
+BENCHMARK(BoardPlaneFragmentsBuilderBuild)->Unit(::benchmark::kMillisecond);
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
@@ -0,0 +1,64 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../../../../benchmarkhelpers.h"
+
+#include <benchmark/benchmark.h>
+#include <librepcb/core/exceptions.h>
+#include <librepcb/core/project/board/board.h>
+#include <librepcb/core/project/board/drc/boarddesignrulecheck.h>
+#include <librepcb/core/project/project.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+/*******************************************************************************
+ *  Benchmarks
+ ******************************************************************************/
+
+static void BoardDesignRuleCheckExecute(::benchmark::State& state) {
+  BenchmarkHelpers::runWithProject(state, "Gerber Test", [](Project& project) {
+    Board& board = BenchmarkHelpers::getFirstBoard(project);
+    // Planes are benchmarked separately, so only measure the checks here.
+    BoardDesignRuleCheck::Options options;
+    options.rebuildPlanes = false;
+    return [&board, options]() {
+      BoardDesignRuleCheck drc(board, options);
+      drc.execute();  // can throw
+      int count = drc.getMessages().count();
+      ::benchmark::DoNotOptimize(count);
+    };
+  });
+}
+BENCHMARK(BoardDesignRuleCheckExecute)->Unit(::benchmark::kMillisecond);
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
@@ -0,0 +1,84 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../../benchmarkhelpers.h"
+
+#include <benchmark/benchmark.h>
+#include <librepcb/core/exceptions.h>
+#include <librepcb/core/fileio/fileutils.h>
+#include <librepcb/core/project/board/board.h>
+#include <librepcb/core/project/project.h>
+#include <librepcb/core/serialization/sexpression.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+/*******************************************************************************
+ *  Benchmarks
+ ******************************************************************************/
+
+static void SExpressionParse(::benchmark::State& state) {
+  int size = 0;
+  BenchmarkHelpers::runWithProject(
+      state, "Gerber Test", [&size](Project& project) {
+        const FilePath fp =
+            BenchmarkHelpers::getFirstBoard(project).getFilePath();
+        const QByteArray content = FileUtils::readFile(fp);  // can throw
+        size = content.size();
+        return [fp, content]() {
+          SExpression root = SExpression::parse(content, fp);  // can throw
+          ::benchmark::DoNotOptimize(root);
+        };
+      });
+  state.SetBytesProcessed(state.iterations() * size);
+}
+BENCHMARK(SExpressionParse)->Unit(::benchmark::kMillisecond);
+
+static void SExpressionToByteArray(::benchmark::State& state) {
+  int size = 0;
+  BenchmarkHelpers::runWithProject(
+      state, "Gerber Test", [&size](Project& project) {
+        const FilePath fp =
+            BenchmarkHelpers::getFirstBoard(project).getFilePath();
+        const QByteArray content = FileUtils::readFile(fp);  // can throw
+        const SExpression root = SExpression::parse(content, fp);  // can throw
+        size = content.size();
+        return [root]() {
+          QByteArray output = root.toByteArray();  // can throw
+          ::benchmark::DoNotOptimize(output);
+        };
+      });
+  state.SetBytesProcessed(state.iterations() * size);
+}
+BENCHMARK(SExpressionToByteArray)->Unit(::benchmark::kMillisecond);
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
@@ -0,0 +1,101 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <benchmark/benchmark.h>
+#include <librepcb/core/types/uuid.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+/*******************************************************************************
+ *  Helpers
+ ******************************************************************************/
+
+static QVector<QString> createRandomUuidStrings(int count) {
+  QVector<QString> strings;
+  strings.reserve(count);
+  for (int i = 0; i < count; ++i) {
+    strings.append(Uuid::createRandom().toStr());
+  }
+  return strings;
+}
+
+/*******************************************************************************
+ *  Benchmarks
+ ******************************************************************************/
+
+static void UuidCreateRandom(::benchmark::State& state) {
+  while (state.KeepRunning()) {
+    Uuid uuid = Uuid::createRandom();
+    ::benchmark::DoNotOptimize(uuid);
+  }
+}
+BENCHMARK(UuidCreateRandom);
+
+static void UuidTryFromString(::benchmark::State& state) {
+  const QVector<QString> strings = createRandomUuidStrings(state.range(0));
+  while (state.KeepRunning()) {
+    foreach (const QString& str, strings) {
+      tl::optional<Uuid> uuid = Uuid::tryFromString(str);
+      ::benchmark::DoNotOptimize(uuid);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(UuidTryFromString)->Range(8, 8 << 10);
+
+static void UuidToStr(::benchmark::State& state) {
+  const Uuid uuid = Uuid::createRandom();
+  while (state.KeepRunning()) {
+    QString str = uuid.toStr();
+    ::benchmark::DoNotOptimize(str);
+  }
+}
+BENCHMARK(UuidToStr);
+
+static void UuidHashInsert(::benchmark::State& state) {
+  QVector<Uuid> uuids;
+  foreach (const QString& str, createRandomUuidStrings(state.range(0))) {
+    uuids.append(Uuid::fromString(str));
+  }
+  while (state.KeepRunning()) {
+    QSet<Uuid> set;
+    foreach (const Uuid& uuid, uuids) {
+      set.insert(uuid);
+    }
+    ::benchmark::DoNotOptimize(set);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(UuidHashInsert)->Range(8, 8 << 10);
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
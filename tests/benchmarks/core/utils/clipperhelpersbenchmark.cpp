@@ -0,0 +1,90 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <benchmark/benchmark.h>
+#include <librepcb/core/exceptions.h>
+#include <librepcb/core/geometry/path.h>
+#include <librepcb/core/utils/clipperhelpers.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+/*******************************************************************************
+ *  Helpers
+ ******************************************************************************/
+
+// Closed zigzag path with an arc between every two vertices.
+static Path createPathWithArcs(int vertexCount) {
+  Path path;
+  for (int i = 0; i < vertexCount; ++i) {
+    path.addVertex(Point(i * 1000000, (i % 2) * 1000000), Angle::deg90());
+  }
+  path.close();
+  return path;
+}
+
+/*******************************************************************************
+ *  Benchmarks
+ ******************************************************************************/
+
+static void ClipperHelpersConvertArcs(::benchmark::State& state) {
+  const Path path = createPathWithArcs(state.range(0));
+  const PositiveLength tolerance(5000);
+  while (state.KeepRunning()) {
+    ClipperLib::Path result = ClipperHelpers::convert(path, tolerance);
+    ::benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(ClipperHelpersConvertArcs)->Range(8, 8 << 10);
+
+static void ClipperHelpersUniteCircles(::benchmark::State& state) {
+  try {
+    ClipperLib::Paths circles;
+    for (int i = 0; i < state.range(0); ++i) {
+      const Path circle = Path::circle(PositiveLength(1000000))
+                              .translated(Point(i * 700000, 0));
+      circles.push_back(ClipperHelpers::convert(circle, PositiveLength(5000)));
+    }
+    while (state.KeepRunning()) {
+      ClipperLib::Paths paths;
+      ClipperHelpers::unite(paths, circles);  // can throw
+      ::benchmark::DoNotOptimize(paths);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  } catch (const Exception& e) {
+    state.SkipWithError(qPrintable(e.getMsg()));
+  }
+}
+BENCHMARK(ClipperHelpersUniteCircles)->Range(8, 8 << 8);
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
@@ -1,6 +1,7 @@
 #!/usr/bin/env python
 # -*- coding: utf-8 -*-
 
+import json
 import params
 import pytest
 
@@ -49,3 +50,19 @@ def test_open_project_verbose(cli, project):
         "Open project '{project.path}'...\n" \
         "SUCCESS\n".format(project=project)
     assert code == 0
+
+
+@pytest.mark.parametrize("project", [params.EMPTY_PROJECT_LPP_PARAM])
+def test_open_project_trace(cli, project):
+    cli.add_project(project.dir, as_lppz=project.is_lppz)
+    code, stdout, stderr = cli.run('open-project', '--trace=trace.json',
+                                   project.path)
+    assert stderr == ''
+    assert stdout == \
+        "Open project '{project.path}'...\n" \
+        "SUCCESS\n".format(project=project)
+    assert code == 0
+    with open(cli.abspath('trace.json'), 'r') as f:
+        trace = json.load(f)
+    names = [event['name'] for event in trace['traceEvents']]
+    assert 'Project::Project' in names
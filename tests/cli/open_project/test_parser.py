@@ -15,6 +15,9 @@ Options:
   -h, --help                         Print this message.
   -v, --version                      Displays version information.
   --verbose                          Verbose output.
+  --trace <file>                     Record timing information of the executed
+                                     operations and write it to the given file
+                                     in the Chrome trace event format.
   --erc                              Run the electrical rule check, print all
                                      non-approved warnings/errors and report
                                      failure (exit code = 1) if there are
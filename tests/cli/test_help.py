@@ -14,12 +14,14 @@ Usage: {executable} [options] command
 LibrePCB Command Line Interface
 
 Options:
-  -h, --help     Print this message.
-  -v, --version  Displays version information.
-  --verbose      Verbose output.
+  -h, --help      Print this message.
+  -v, --version   Displays version information.
+  --verbose       Verbose output.
+  --trace <file>  Record timing information of the executed operations and
+                  write it to the given file in the Chrome trace event format.
 
 Arguments:
-  command        The command to execute (see list below).
+  command         The command to execute (see list below).
 
 Commands:
   open-library   Open a library to execute library-related tasks.
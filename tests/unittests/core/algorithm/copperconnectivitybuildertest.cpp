@@ -0,0 +1,219 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <librepcb/core/algorithm/copperconnectivitybuilder.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class CopperConnectivityBuilderTest : public ::testing::Test {
+protected:
+  static ClipperLib::Paths rect(ClipperLib::cInt left, ClipperLib::cInt top,
+                                ClipperLib::cInt right,
+                                ClipperLib::cInt bottom) noexcept {
+    return {{{left, top}, {right, top}, {right, bottom}, {left, bottom}}};
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(CopperConnectivityBuilderTest, testEmpty) {
+  CopperConnectivityBuilder builder;
+  builder.build();
+  EXPECT_EQ(0, builder.getItemCount());
+  EXPECT_EQ(0, builder.getClusterCount());
+}
+
+TEST_F(CopperConnectivityBuilderTest, testOverlappingItems) {
+  CopperConnectivityBuilder builder;
+  int a = builder.addItem("top", rect(0, 0, 100, 100));
+  int b = builder.addItem("top", rect(50, 50, 150, 150));
+  int c = builder.addItem("top", rect(160, 0, 200, 60));
+  builder.build();
+  EXPECT_EQ(2, builder.getClusterCount());
+  EXPECT_EQ(builder.getClusterOfItem(a), builder.getClusterOfItem(b));
+  EXPECT_NE(builder.getClusterOfItem(a), builder.getClusterOfItem(c));
+}
+
+TEST_F(CopperConnectivityBuilderTest, testChain) {
+  CopperConnectivityBuilder builder;
+  int first = builder.addItem("top", rect(0, 0, 20, 10));
+  int last = first;
+  for (int i = 1; i < 10; ++i) {
+    last = builder.addItem("top", rect(i * 15, 0, i * 15 + 20, 10));
+  }
+  builder.build();
+  EXPECT_EQ(1, builder.getClusterCount());
+  EXPECT_EQ(builder.getClusterOfItem(first), builder.getClusterOfItem(last));
+}
+
+TEST_F(CopperConnectivityBuilderTest, testOverlappingBoundingBoxesOnly) {
+  // The bounding boxes of the triangles overlap, but not the areas.
+  CopperConnectivityBuilder builder;
+  int a = builder.addItem("top", {{{0, 0}, {100, 0}, {0, 100}}});
+  int b = builder.addItem("top", {{{100, 10}, {100, 100}, {10, 100}}});
+  builder.build();
+  EXPECT_EQ(2, builder.getClusterCount());
+  EXPECT_NE(builder.getClusterOfItem(a), builder.getClusterOfItem(b));
+}
+
+TEST_F(CopperConnectivityBuilderTest, testDifferentLayers) {
+  CopperConnectivityBuilder builder;
+  int a = builder.addItem("top", rect(0, 0, 100, 100));
+  int b = builder.addItem("bot", rect(0, 0, 100, 100));
+  builder.build();
+  EXPECT_EQ(2, builder.getClusterCount());
+  EXPECT_NE(builder.getClusterOfItem(a), builder.getClusterOfItem(b));
+}
+
+TEST_F(CopperConnectivityBuilderTest, testItemOnAllLayersConnectsLayers) {
+  CopperConnectivityBuilder builder;
+  int a = builder.addItem("top", rect(0, 0, 100, 10));
+  int via = builder.addItem(QString(), rect(90, 0, 110, 20));
+  int b = builder.addItem("bot", rect(100, 0, 200, 10));
+  int c = builder.addItem("bot", rect(300, 0, 400, 10));
+  builder.build();
+  EXPECT_EQ(2, builder.getClusterCount());
+  EXPECT_EQ(builder.getClusterOfItem(a), builder.getClusterOfItem(via));
+  EXPECT_EQ(builder.getClusterOfItem(a), builder.getClusterOfItem(b));
+  EXPECT_NE(builder.getClusterOfItem(a), builder.getClusterOfItem(c));
+}
+
+TEST_F(CopperConnectivityBuilderTest, testNoShortCircuitWithinSameNet) {
+  CopperConnectivityBuilder builder;
+  builder.addItem("top", rect(0, 0, 100, 100), 0);
+  builder.addItem("top", rect(50, 0, 150, 100), 0);
+  builder.addItem("top", rect(25, 50, 125, 150), 0);
+  builder.build();
+  EXPECT_EQ(1, builder.getClusterCount());
+  EXPECT_EQ(0, builder.getShortCircuits().count());
+}
+
+TEST_F(CopperConnectivityBuilderTest, testShortCircuitsOfDirectOverlaps) {
+  // Chain a1 - b1 - b2 - c1 - a2: Only the overlaps between different nets
+  // are short circuits, and each of them is reported separately even though
+  // all items are in the same cluster.
+  CopperConnectivityBuilder builder;
+  int a1 = builder.addItem("top", rect(0, 0, 100, 10), 0);
+  int b1 = builder.addItem("top", rect(90, 0, 200, 10), 1);
+  int b2 = builder.addItem("top", rect(190, 0, 300, 10), 1);
+  int c1 = builder.addItem("top", rect(290, 0, 400, 10), 2);
+  int a2 = builder.addItem("top", rect(390, 0, 500, 10), 0);
+  builder.build();
+  EXPECT_EQ(1, builder.getClusterCount());
+  const auto& shorts = builder.getShortCircuits();
+  ASSERT_EQ(3, shorts.count());
+  EXPECT_EQ(0, shorts.at(0).net1);
+  EXPECT_EQ(1, shorts.at(0).net2);
+  ASSERT_EQ(1, shorts.at(0).overlaps.count());
+  EXPECT_EQ(std::make_pair(a1, b1), shorts.at(0).overlaps.first());
+  EXPECT_EQ(0, shorts.at(1).net1);
+  EXPECT_EQ(2, shorts.at(1).net2);
+  ASSERT_EQ(1, shorts.at(1).overlaps.count());
+  EXPECT_EQ(std::make_pair(c1, a2), shorts.at(1).overlaps.first());
+  EXPECT_EQ(1, shorts.at(2).net1);
+  EXPECT_EQ(2, shorts.at(2).net2);
+  ASSERT_EQ(1, shorts.at(2).overlaps.count());
+  EXPECT_EQ(std::make_pair(b2, c1), shorts.at(2).overlaps.first());
+}
+
+TEST_F(CopperConnectivityBuilderTest, testShortCircuitOfItemsOnAllLayers) {
+  // Overlapping vias must be reported only once, not once per layer.
+  CopperConnectivityBuilder builder;
+  builder.addItem("top", rect(500, 0, 600, 100), 0);
+  builder.addItem("bot", rect(500, 0, 600, 100), 0);
+  int via1 = builder.addItem(QString(), rect(0, 0, 100, 100), 0);
+  int via2 = builder.addItem(QString(), rect(50, 0, 150, 100), 1);
+  builder.build();
+  const auto& shorts = builder.getShortCircuits();
+  ASSERT_EQ(1, shorts.count());
+  EXPECT_EQ(0, shorts.first().net1);
+  EXPECT_EQ(1, shorts.first().net2);
+  ASSERT_EQ(1, shorts.first().overlaps.count());
+  EXPECT_EQ(std::make_pair(via1, via2), shorts.first().overlaps.first());
+}
+
+TEST_F(CopperConnectivityBuilderTest, testShortCircuitsThroughUnconnected) {
+  // The unconnected items u1 and u2 short the nets 0, 1 and 2, while the
+  // unconnected item u3 only touches net 0 and thus is no short circuit.
+  CopperConnectivityBuilder builder;
+  int a = builder.addItem("top", rect(0, 0, 100, 10), 0);
+  int u1 = builder.addItem("top", rect(90, 0, 200, 10));
+  int b = builder.addItem("top", rect(150, 5, 160, 50), 1);
+  int u2 = builder.addItem("top", rect(190, 0, 300, 10));
+  int c = builder.addItem("top", rect(290, 0, 400, 10), 2);
+  builder.addItem("top", rect(0, 5, 10, 100));
+  builder.build();
+  EXPECT_EQ(1, builder.getClusterCount());
+  const auto& shorts = builder.getShortCircuits();
+  ASSERT_EQ(2, shorts.count());
+  EXPECT_EQ(0, shorts.at(0).net1);
+  EXPECT_EQ(1, shorts.at(0).net2);
+  EXPECT_EQ(2, shorts.at(0).overlaps.count());
+  EXPECT_TRUE(shorts.at(0).overlaps.contains(std::make_pair(a, u1)));
+  EXPECT_TRUE(shorts.at(0).overlaps.contains(std::make_pair(u1, b)));
+  EXPECT_EQ(1, shorts.at(1).net1);
+  EXPECT_EQ(2, shorts.at(1).net2);
+  EXPECT_EQ(2, shorts.at(1).overlaps.count());
+  EXPECT_TRUE(shorts.at(1).overlaps.contains(std::make_pair(u1, b)));
+  EXPECT_TRUE(shorts.at(1).overlaps.contains(std::make_pair(u2, c)));
+}
+
+TEST_F(CopperConnectivityBuilderTest, testNoShortCircuitThroughUnconnected) {
+  CopperConnectivityBuilder builder;
+  builder.addItem("top", rect(0, 0, 100, 10), 0);
+  builder.addItem("top", rect(90, 0, 200, 10));
+  builder.addItem("top", rect(190, 0, 300, 10), 0);
+  builder.addItem("top", rect(500, 0, 600, 10), 1);
+  builder.build();
+  EXPECT_EQ(2, builder.getClusterCount());
+  EXPECT_EQ(0, builder.getShortCircuits().count());
+}
+
+TEST_F(CopperConnectivityBuilderTest, testEmptyItem) {
+  CopperConnectivityBuilder builder;
+  int a = builder.addItem("top", rect(0, 0, 100, 100));
+  int b = builder.addItem("top", ClipperLib::Paths());
+  builder.build();
+  EXPECT_EQ(2, builder.getClusterCount());
+  EXPECT_NE(builder.getClusterOfItem(a), builder.getClusterOfItem(b));
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
@@ -63,6 +63,78 @@ TEST_P(AttributeSubstitutorTest, testData) {
       << "Actual value: '" << qPrintable(output) << "'";
 }
 
+TEST_P(AttributeSubstitutorTest, testDependencies) {
+  const AttributeSubstitutorTestData& data = GetParam();
+
+  AttributeProviderDummy ap;
+  AttributeSubstitutor::Dependencies dependencies;
+  QString output =
+      AttributeSubstitutor::substitute(data.input, &ap, nullptr, &dependencies);
+  EXPECT_EQ(data.output, output)
+      << "Actual value: '" << qPrintable(output) << "'";
+  EXPECT_TRUE(AttributeSubstitutor::isUpToDate(dependencies, &ap));
+}
+
+class AttributeSubstitutorMutableProvider final : public AttributeProvider {
+public:
+  QString getUserDefinedAttributeValue(const QString& key) const
+      noexcept override {
+    return mAttributes.value(key);
+  }
+  QHash<QString, QString> mAttributes;
+
+signals:
+  void attributesChanged() override {}
+};
+
+TEST(AttributeSubstitutorDependenciesTest, testIsUpToDate) {
+  AttributeSubstitutorMutableProvider ap;
+  ap.mAttributes.insert("NAME", "R1");
+  ap.mAttributes.insert("VALUE", "{{RESISTANCE}}");
+  ap.mAttributes.insert("RESISTANCE", "10k");
+  ap.mAttributes.insert("VERSION", "v1");
+
+  AttributeSubstitutor::Dependencies dependencies;
+  EXPECT_EQ("R1 10k", AttributeSubstitutor::substitute("{{NAME}} {{VALUE}}",
+                                                       &ap, nullptr,
+                                                       &dependencies));
+  EXPECT_TRUE(AttributeSubstitutor::isUpToDate(dependencies, &ap));
+
+  // unreferenced attribute changed
+  ap.mAttributes.insert("VERSION", "v2");
+  EXPECT_TRUE(AttributeSubstitutor::isUpToDate(dependencies, &ap));
+
+  // indirectly referenced attribute changed
+  ap.mAttributes.insert("RESISTANCE", "22k");
+  EXPECT_FALSE(AttributeSubstitutor::isUpToDate(dependencies, &ap));
+  EXPECT_EQ("R1 22k", AttributeSubstitutor::substitute("{{NAME}} {{VALUE}}",
+                                                       &ap, nullptr,
+                                                       &dependencies));
+  EXPECT_TRUE(AttributeSubstitutor::isUpToDate(dependencies, &ap));
+
+  // previously undefined attribute got defined
+  EXPECT_EQ("", AttributeSubstitutor::substitute("{{FOO or NAME_2}}", &ap,
+                                                 nullptr, &dependencies));
+  ap.mAttributes.insert("NAME_2", "R2");
+  EXPECT_FALSE(AttributeSubstitutor::isUpToDate(dependencies, &ap));
+
+  // empty attribute got a value
+  ap.mAttributes.insert("EMPTY", "");
+  EXPECT_EQ("R1", AttributeSubstitutor::substitute("{{EMPTY or NAME}}", &ap,
+                                                   nullptr, &dependencies));
+  ASSERT_EQ(2, dependencies.count());
+  EXPECT_FALSE(dependencies.first().found);
+  EXPECT_TRUE(dependencies.last().found);
+  EXPECT_TRUE(AttributeSubstitutor::isUpToDate(dependencies, &ap));
+  ap.mAttributes.insert("EMPTY", "foo");
+  EXPECT_FALSE(AttributeSubstitutor::isUpToDate(dependencies, &ap));
+
+  // no attributes referenced at all
+  EXPECT_EQ("text", AttributeSubstitutor::substitute("text", &ap, nullptr,
+                                                     &dependencies));
+  EXPECT_TRUE(dependencies.isEmpty());
+}
+
 /*******************************************************************************
  *  Test Data
  ******************************************************************************/
@@ -186,6 +186,97 @@ TEST_F(GraphicsExportTest, testExportMultipleImages) {
   EXPECT_EQ("600x300", str(getImageSize(getFilePath("out3.png"))));
 }
 
+TEST_F(GraphicsExportTest, testSavingFileEmittedBeforeWriting) {
+  std::shared_ptr<GraphicsPagePainter> page =
+      std::make_shared<GraphicsPagePainterMock>();
+  std::shared_ptr<GraphicsExportSettings> settings =
+      std::make_shared<GraphicsExportSettings>();
+  GraphicsExport::Pages pages = {
+      std::make_pair(page, settings),
+      std::make_pair(page, settings),
+      std::make_pair(page, settings),
+  };
+
+  GraphicsExport e;
+  QVector<bool> existingFiles;
+  QObject::connect(&e, &GraphicsExport::savingFile,
+                   [&existingFiles](const FilePath& fp) {
+                     existingFiles.append(fp.isExistingFile());
+                   });
+
+  e.startExport(pages, getFilePath("out.svg"));
+  e.waitForFinished();
+  EXPECT_EQ(QVector<bool>({false, false, false}), existingFiles);
+  EXPECT_TRUE(getFilePath("out1.svg").isExistingFile());
+  EXPECT_TRUE(getFilePath("out2.svg").isExistingFile());
+  EXPECT_TRUE(getFilePath("out3.svg").isExistingFile());
+}
+
+TEST_F(GraphicsExportTest, testExportMultipleImagesSequentially) {
+  std::shared_ptr<GraphicsPagePainter> page =
+      std::make_shared<GraphicsPagePainterMock>(
+          Length(10000000), Length(20000000), Length(508000000),
+          Length(254000000));
+  std::shared_ptr<GraphicsExportSettings> settings1 =
+      std::make_shared<GraphicsExportSettings>();
+  settings1->setPixmapDpi(10);
+  settings1->setScale(tl::nullopt);
+  settings1->setMarginLeft(UnsignedLength(0));
+  settings1->setMarginTop(UnsignedLength(0));
+  settings1->setMarginRight(UnsignedLength(0));
+  settings1->setMarginBottom(UnsignedLength(0));
+  std::shared_ptr<GraphicsExportSettings> settings2 =
+      std::make_shared<GraphicsExportSettings>(*settings1);
+  settings2->setPixmapDpi(20);
+  GraphicsExport::Pages pages = {
+      std::make_pair(page, settings1),
+      std::make_pair(page, settings2),
+  };
+
+  GraphicsExport e;
+  e.setMaxThreadCount(1);
+  prepare(e);
+
+  e.startExport(pages, getFilePath("out.png"));
+  e.waitForFinished();
+  EXPECT_EQ(str({
+                getFilePath("out1.png"),
+                getFilePath("out2.png"),
+            }),
+            str(mSavedFiles));
+  EXPECT_EQ("200x100", str(getImageSize(getFilePath("out1.png"))));
+  EXPECT_EQ("400x200", str(getImageSize(getFilePath("out2.png"))));
+}
+
+TEST_F(GraphicsExportTest, testPreviewPagesInOrder) {
+  GraphicsExport::Pages pages;
+  for (int i = 1; i <= 10; ++i) {
+    std::shared_ptr<GraphicsExportSettings> settings =
+        std::make_shared<GraphicsExportSettings>();
+    settings->setPageSize(tl::nullopt);
+    settings->setPixmapDpi(10 * i);
+    pages.append(std::make_pair(std::make_shared<GraphicsPagePainterMock>(),
+                                settings));
+  }
+
+  GraphicsExport e;
+  e.setMaxThreadCount(4);
+  QVector<int> indices;
+  QObject::connect(
+      &e, &GraphicsExport::previewReady,
+      [&indices](int index, const QSize& pageSize, const QRectF margins,
+                 std::shared_ptr<QPicture> picture) {
+        Q_UNUSED(pageSize);
+        Q_UNUSED(margins);
+        EXPECT_TRUE(picture != nullptr);
+        indices.append(index);
+      });
+
+  e.startPreview(pages);
+  EXPECT_TRUE(e.waitForFinished().isNull());
+  EXPECT_EQ((QVector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}), indices);
+}
+
 TEST_F(GraphicsExportTest, testExportSvgWithAutoScaling) {
   std::shared_ptr<GraphicsPagePainter> page =
       std::make_shared<GraphicsPagePainterMock>(
@@ -163,6 +163,30 @@ TEST_F(TransactionalFileSystemTest, testWriteIsDelayedUntilSave) {
   EXPECT_EQ("content", FileUtils::readFile(fp));
 }
 
+TEST_F(TransactionalFileSystemTest, testWriteUnmodifiedContent) {
+  TransactionalFileSystem fs(mPopulatedDir, true);
+  ASSERT_EQ("1", fs.read("1.txt"));
+
+  // writing the same content as on disk is not a modification
+  fs.write("1.txt", "1");
+  EXPECT_EQ(0, fs.checkForModifications().count());
+
+  // writing back the original content reverts the modification
+  fs.write("1.txt", "new content");
+  EXPECT_EQ(QStringList{"1.txt"}, fs.checkForModifications());
+  fs.write("1.txt", "1");
+  EXPECT_EQ(0, fs.checkForModifications().count());
+  EXPECT_EQ("1", fs.read("1.txt"));
+
+  // after saving, the new content is the reference
+  fs.write("1.txt", "new content");
+  fs.save();
+  fs.write("1.txt", "new content");
+  EXPECT_EQ(0, fs.checkForModifications().count());
+  EXPECT_EQ("new content",
+            FileUtils::readFile(mPopulatedDir.getPathTo("1.txt")));
+}
+
 TEST_F(TransactionalFileSystemTest, testRemoveExistingFile) {
   FilePath fp = mPopulatedDir.getPathTo("1/1a.txt");
   TransactionalFileSystem fs(mPopulatedDir, true);
@@ -442,6 +466,28 @@ TEST_F(TransactionalFileSystemTest, testAutosaveIsRemovedInDestructor) {
   EXPECT_FALSE(fp.isExistingDir());
 }
 
+TEST_F(TransactionalFileSystemTest, testAutosaveAsync) {
+  TransactionalFileSystem fs(mPopulatedDir, true);
+  fs.write("1.txt", "new 1");
+  QFuture<bool> future = fs.autosaveAsync();
+
+  // modifications after starting the autosave must not be written
+  fs.write("1.txt", "newer 1");
+  fs.write("x.txt", "x");
+  EXPECT_TRUE(future.result());
+  EXPECT_FALSE(fs.isAutosaveInProgress());
+
+  // remove lock because we can't get a stale lock without crashing the app
+  FileUtils::removeFile(mPopulatedDir.getPathTo(".lock"));
+
+  // open another file system on the same directory to restore the autosave
+  TransactionalFileSystem fs2(mPopulatedDir, true,
+                              &TransactionalFileSystem::RestoreMode::yes);
+  EXPECT_TRUE(fs2.isRestoredFromAutosave());
+  EXPECT_EQ("new 1", fs2.read("1.txt"));
+  EXPECT_FALSE(fs2.fileExists("x.txt"));
+}
+
 TEST_F(TransactionalFileSystemTest, testRestoreAutosave) {
   TransactionalFileSystem fs(mPopulatedDir, true);
 
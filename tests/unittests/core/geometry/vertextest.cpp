@@ -69,6 +69,13 @@ TEST_F(VertexTest, testSerializeAndDeserialize) {
   EXPECT_EQ(sexpr1.toByteArray(), sexpr2.toByteArray());
 }
 
+TEST_F(VertexTest, testMemoryFootprint) {
+  // Vertices are stored millions of times in large projects, so make sure
+  // they don't contain more than the position and angle (e.g. no vtable).
+  EXPECT_EQ(2 * sizeof(Length), sizeof(Point));
+  EXPECT_LE(sizeof(Vertex), sizeof(Point) + sizeof(qint64));
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -52,7 +52,8 @@ protected:
   /**
    * @brief Helper to easily compare objects as strings for easier debugging
    */
-  static std::string str(const SerializableObject& obj) {
+  template <typename T>
+  static std::string str(const T& obj) {
     return obj.serializeToDomElement("object").toByteArray().toStdString();
   }
 
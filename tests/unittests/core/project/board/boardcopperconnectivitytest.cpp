@@ -0,0 +1,165 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/core/fileio/transactionalfilesystem.h>
+#include <librepcb/core/graphics/graphicslayer.h>
+#include <librepcb/core/project/board/board.h>
+#include <librepcb/core/project/board/drc/boardcopperconnectivity.h>
+#include <librepcb/core/project/board/items/bi_netsegment.h>
+#include <librepcb/core/project/board/items/bi_polygon.h>
+#include <librepcb/core/project/board/items/bi_via.h>
+#include <librepcb/core/project/circuit/circuit.h>
+#include <librepcb/core/project/circuit/netclass.h>
+#include <librepcb/core/project/circuit/netsignal.h>
+#include <librepcb/core/project/project.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class BoardCopperConnectivityTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    mProjectDir = FilePath::getRandomTempPath();
+    mProject.reset(Project::create(
+        std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
+            TransactionalFileSystem::openRW(mProjectDir))),
+        "project.lpp"));
+    mBoard = mProject->createBoard(ElementName("board"));
+    mProject->addBoard(*mBoard);
+  }
+
+  void TearDown() override {
+    mProject.reset();
+    QDir(mProjectDir.toStr()).removeRecursively();
+  }
+
+  NetSignal* addNetSignal(const QString& name) {
+    Circuit& circuit = mProject->getCircuit();
+    NetSignal* netsignal =
+        new NetSignal(circuit, *circuit.getNetClasses().first(),
+                      CircuitIdentifier(name), false);
+    circuit.addNetSignal(*netsignal);
+    return netsignal;
+  }
+
+  void addVia(NetSignal& netsignal, const Point& pos) {
+    BI_NetSegment* netsegment = new BI_NetSegment(*mBoard, &netsignal);
+    mBoard->addNetSegment(*netsegment);
+    BI_Via* via = new BI_Via(
+        *netsegment,
+        Via(Uuid::createRandom(), pos, Via::Shape::Round,
+            PositiveLength(1000000), PositiveLength(300000)));
+    netsegment->addElements({via}, {}, {});
+  }
+
+  void addPolygon(const Point& p1, const Point& p2) {
+    BI_Polygon* polygon = new BI_Polygon(
+        *mBoard, Uuid::createRandom(),
+        GraphicsLayerName(GraphicsLayer::sTopCopper), UnsignedLength(0), true,
+        false, Path::rect(p1, p2));
+    mBoard->addPolygon(*polygon);
+  }
+
+  static QStringList getShortCircuits(const BoardCopperConnectivity& c) {
+    QStringList shortCircuits;
+    foreach (const auto& sc, c.getShortCircuits()) {
+      QStringList names = {*sc.netSignal1->getName(),
+                           *sc.netSignal2->getName()};
+      names.sort();
+      shortCircuits.append(names.join("-"));
+      EXPECT_FALSE(sc.location.isEmpty());
+    }
+    shortCircuits.sort();
+
+    // The cheap variant must return the same net signals.
+    QStringList shortCircuitNets;
+    foreach (const auto& nets, c.getShortCircuitNets()) {
+      QStringList names = {*nets.first->getName(), *nets.second->getName()};
+      names.sort();
+      shortCircuitNets.append(names.join("-"));
+    }
+    shortCircuitNets.sort();
+    EXPECT_EQ(shortCircuits, shortCircuitNets);
+    return shortCircuits;
+  }
+
+  FilePath mProjectDir;
+  QScopedPointer<Project> mProject;
+  Board* mBoard;
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(BoardCopperConnectivityTest, testNoShortCircuits) {
+  NetSignal* a = addNetSignal("A");
+  NetSignal* b = addNetSignal("B");
+  addVia(*a, Point(0, 0));
+  addVia(*a, Point(800000, 0));
+  addVia(*b, Point(5000000, 0));
+  addPolygon(Point(800000, -100000), Point(4000000, 100000));
+
+  BoardCopperConnectivity connectivity(*mBoard, PositiveLength(5000));
+  connectivity.build();
+  EXPECT_EQ(QStringList(), getShortCircuits(connectivity));
+}
+
+TEST_F(BoardCopperConnectivityTest, testShortCircuits) {
+  NetSignal* a = addNetSignal("A");
+  NetSignal* b = addNetSignal("B");
+  NetSignal* c = addNetSignal("C");
+
+  // Chain A1 - B1 - B2 - C1: There are exactly two short circuits, while the
+  // overlap of B1 and B2 is no short circuit.
+  addVia(*a, Point(0, 0));
+  addVia(*b, Point(800000, 0));
+  addVia(*b, Point(1600000, 0));
+  addVia(*c, Point(2400000, 0));
+
+  // A2 and C2 are connected through an unconnected polygon.
+  addVia(*a, Point(10000000, 0));
+  addVia(*c, Point(12000000, 0));
+  addPolygon(Point(10000000, -100000), Point(12000000, 100000));
+
+  BoardCopperConnectivity connectivity(*mBoard, PositiveLength(5000));
+  connectivity.build();
+  EXPECT_EQ(QStringList({"A-B", "A-C", "B-C"}),
+            getShortCircuits(connectivity));
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
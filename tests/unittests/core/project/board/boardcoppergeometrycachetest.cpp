@@ -0,0 +1,107 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/core/fileio/transactionalfilesystem.h>
+#include <librepcb/core/project/board/board.h>
+#include <librepcb/core/project/board/drc/boardcoppergeometrycache.h>
+#include <librepcb/core/project/board/items/bi_plane.h>
+#include <librepcb/core/project/project.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class BoardCopperGeometryCacheTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    FilePath projectFp(TEST_DATA_DIR "/projects/Nested Planes/project.lpp");
+    std::shared_ptr<TransactionalFileSystem> projectFs =
+        TransactionalFileSystem::openRO(projectFp.getParentDir());
+    mProject.reset(new Project(std::unique_ptr<TransactionalDirectory>(
+                                   new TransactionalDirectory(projectFs)),
+                               projectFp.getFilename()));
+    mBoard = mProject->getBoards().first();
+    mBoard->rebuildAllPlanes();
+  }
+
+  QScopedPointer<Project> mProject;
+  Board* mBoard;
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(BoardCopperGeometryCacheTest, testEntriesAreComputedOnce) {
+  BoardCopperGeometryCache& cache = mBoard->getCopperGeometryCache();
+  cache.invalidateAll();
+  EXPECT_EQ(0, cache.getCachedEntriesCount());
+
+  BI_Plane* plane = mBoard->getPlanes().first();
+  auto entry1 = cache.get(*plane->getLayerName(), &plane->getNetSignal());
+  auto entry2 = cache.get(*plane->getLayerName(), &plane->getNetSignal());
+  EXPECT_EQ(entry1.get(), entry2.get());
+  EXPECT_EQ(1, cache.getCachedEntriesCount());
+  EXPECT_FALSE(entry1->isEmpty);
+  EXPECT_LT(entry1->boundingBox.left, entry1->boundingBox.right);
+  EXPECT_LT(entry1->boundingBox.top, entry1->boundingBox.bottom);
+}
+
+TEST_F(BoardCopperGeometryCacheTest, testModificationInvalidatesOnlyItsNet) {
+  BoardCopperGeometryCache& cache = mBoard->getCopperGeometryCache();
+  BI_Plane* plane = mBoard->getPlanes().first();
+  const QString layer = *plane->getLayerName();
+  auto planeEntry = cache.get(layer, &plane->getNetSignal());
+  auto unconnectedEntry = cache.get(layer, nullptr);
+
+  plane->clear();
+
+  // The returned entry is not affected by the invalidation.
+  EXPECT_FALSE(planeEntry->isEmpty);
+  EXPECT_NE(planeEntry.get(), cache.get(layer, &plane->getNetSignal()).get());
+  EXPECT_EQ(unconnectedEntry.get(), cache.get(layer, nullptr).get());
+}
+
+TEST_F(BoardCopperGeometryCacheTest, testBoundingBoxesNear) {
+  const ClipperLib::IntRect a{0, 0, 100, 100};
+  const ClipperLib::IntRect b{150, 0, 250, 100};
+  EXPECT_FALSE(BoardCopperGeometryCache::boundingBoxesNear(a, b, Length(49)));
+  EXPECT_TRUE(BoardCopperGeometryCache::boundingBoxesNear(a, b, Length(50)));
+  EXPECT_TRUE(BoardCopperGeometryCache::boundingBoxesNear(b, a, Length(50)));
+  EXPECT_TRUE(BoardCopperGeometryCache::boundingBoxesNear(a, a, Length(0)));
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
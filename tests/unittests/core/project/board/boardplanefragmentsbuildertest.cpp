@@ -104,6 +104,42 @@ TEST(BoardPlaneFragmentsBuilderTest, testFragments) {
   EXPECT_EQ(expected.toStdString(), actual.toStdString());
 }
 
+TEST(BoardPlaneFragmentsBuilderTest, testRebuildModifiedPlanes) {
+  // open project from test data directory
+  FilePath projectFp(TEST_DATA_DIR "/projects/Nested Planes/project.lpp");
+  std::shared_ptr<TransactionalFileSystem> projectFs =
+      TransactionalFileSystem::openRO(projectFp.getParentDir());
+  QScopedPointer<Project> project(
+      new Project(std::unique_ptr<TransactionalDirectory>(
+                      new TransactionalDirectory(projectFs)),
+                  projectFp.getFilename()));
+  Board* board = project->getBoards().first();
+  board->rebuildAllPlanes();
+
+  // without modifications, nothing needs to be rebuilt
+  EXPECT_EQ(0, board->rebuildModifiedPlanes());
+
+  // modify a single plane
+  BI_Plane* plane = board->getPlanes().first();
+  plane->setMinClearance(
+      UnsignedLength(*plane->getMinClearance() + Length(200000)));
+  const int rebuilt = board->rebuildModifiedPlanes();
+  EXPECT_GE(rebuilt, 1);
+  EXPECT_LE(rebuilt, board->getPlanes().count());
+  EXPECT_EQ(0, board->rebuildModifiedPlanes());
+
+  // the result must be identical to rebuilding all planes
+  QMap<Uuid, QVector<Path>> incrementalFragments;
+  foreach (const BI_Plane* p, board->getPlanes()) {
+    incrementalFragments.insert(p->getUuid(), p->getFragments());
+  }
+  board->rebuildAllPlanes();
+  foreach (const BI_Plane* p, board->getPlanes()) {
+    EXPECT_EQ(incrementalFragments.value(p->getUuid()), p->getFragments())
+        << qPrintable(p->getUuid().toStr());
+  }
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
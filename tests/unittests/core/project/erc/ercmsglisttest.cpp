@@ -0,0 +1,129 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/core/fileio/transactionalfilesystem.h>
+#include <librepcb/core/project/erc/ercmsglist.h>
+#include <librepcb/core/project/erc/if_ercmsgprovider.h>
+#include <librepcb/core/project/project.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Helper Classes
+ ******************************************************************************/
+
+class ErcMsgProviderCounter final : public IF_ErcMsgProvider {
+  DECLARE_ERC_MSG_CLASS_NAME(ErcMsgProviderCounter)
+
+public:
+  int updateCount = 0;
+  void updateScheduledErcMessages() noexcept override { ++updateCount; }
+};
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class ErcMsgListTest : public ::testing::Test {
+protected:
+  FilePath mProjectDir;
+  QScopedPointer<Project> mProject;
+
+  ErcMsgListTest() {
+    mProjectDir = FilePath::getRandomTempPath();
+    mProject.reset(Project::create(
+        std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
+            TransactionalFileSystem::openRW(mProjectDir))),
+        "test.lpp"));
+  }
+
+  virtual ~ErcMsgListTest() {
+    mProject.reset();
+    QDir(mProjectDir.toStr()).removeRecursively();
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(ErcMsgListTest, testScheduleUpdateWithoutBatch) {
+  ErcMsgProviderCounter provider;
+  mProject->getErcMsgList().scheduleUpdate(provider);
+  EXPECT_EQ(1, provider.updateCount);
+  mProject->getErcMsgList().scheduleUpdate(provider);
+  EXPECT_EQ(2, provider.updateCount);
+}
+
+TEST_F(ErcMsgListTest, testScheduleUpdateWithinNestedBatch) {
+  ErcMsgList& list = mProject->getErcMsgList();
+  ErcMsgProviderCounter provider1;
+  ErcMsgProviderCounter provider2;
+  list.beginUpdateBatch();
+  list.beginUpdateBatch();
+  list.scheduleUpdate(provider1);
+  list.scheduleUpdate(provider2);
+  list.scheduleUpdate(provider1);
+  list.endUpdateBatch();
+  EXPECT_EQ(0, provider1.updateCount);
+  EXPECT_EQ(0, provider2.updateCount);
+  list.endUpdateBatch();
+  EXPECT_EQ(1, provider1.updateCount);
+  EXPECT_EQ(1, provider2.updateCount);
+}
+
+TEST_F(ErcMsgListTest, testUpdateScheduledProviders) {
+  ErcMsgList& list = mProject->getErcMsgList();
+  ErcMsgProviderCounter provider;
+  list.beginUpdateBatch();
+  list.scheduleUpdate(provider);
+  list.updateScheduledProviders();
+  EXPECT_EQ(1, provider.updateCount);
+  list.updateScheduledProviders();
+  EXPECT_EQ(1, provider.updateCount);
+  list.endUpdateBatch();
+  EXPECT_EQ(1, provider.updateCount);
+}
+
+TEST_F(ErcMsgListTest, testCancelScheduledUpdate) {
+  ErcMsgList& list = mProject->getErcMsgList();
+  ErcMsgProviderCounter provider;
+  list.beginUpdateBatch();
+  list.scheduleUpdate(provider);
+  list.cancelScheduledUpdate(provider);
+  list.endUpdateBatch();
+  EXPECT_EQ(0, provider.updateCount);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
@@ -0,0 +1,181 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/core/fileio/fileutils.h>
+#include <librepcb/core/project/projectcache.h>
+#include <librepcb/core/serialization/sexpression.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class ProjectCacheTest : public ::testing::Test {
+protected:
+  FilePath mProjectDir;
+  FilePath mCacheFile;
+  FilePath mFile;
+  QByteArray mContent;
+
+  ProjectCacheTest() {
+    mProjectDir = FilePath::getRandomTempPath();
+    mCacheFile = FilePath::getRandomTempPath().getPathTo("project.lpcache");
+    mFile = mProjectDir.getPathTo("boards/default/board.lp");
+    mContent = "(librepcb_board 00000000-0000-4000-8000-000000000000\n"
+               " (name \"Foo\")\n"
+               ")\n";
+  }
+
+  virtual ~ProjectCacheTest() {
+    QDir(mProjectDir.toStr()).removeRecursively();
+    QDir(mCacheFile.getParentDir().toStr()).removeRecursively();
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(ProjectCacheTest, testParseIsCached) {
+  {
+    ProjectCache cache(mProjectDir, mCacheFile, true);
+    SExpression root = cache.parse(mContent, mFile);
+    EXPECT_EQ(mContent.toStdString(), root.toByteArray().toStdString());
+    EXPECT_FALSE(cache.getFilePath().isExistingFile());
+    cache.save();
+    EXPECT_TRUE(cache.getFilePath().isExistingFile());
+  }
+
+  // Reopen cache and check if the same tree is returned.
+  ProjectCache cache(mProjectDir, mCacheFile, true);
+  SExpression root = cache.parse(mContent, mFile);
+  EXPECT_EQ(mContent.toStdString(), root.toByteArray().toStdString());
+}
+
+TEST_F(ProjectCacheTest, testModifiedFileIsParsedAgain) {
+  {
+    ProjectCache cache(mProjectDir, mCacheFile, true);
+    cache.parse(mContent, mFile);
+    cache.save();
+  }
+
+  ProjectCache cache(mProjectDir, mCacheFile, true);
+  QByteArray content = mContent;
+  content.replace("Foo", "Bar");
+  SExpression root = cache.parse(content, mFile);
+  EXPECT_EQ(content.toStdString(), root.toByteArray().toStdString());
+}
+
+TEST_F(ProjectCacheTest, testGetSet) {
+  const QByteArray hash = ProjectCache::calcHash("input");
+  {
+    ProjectCache cache(mProjectDir, mCacheFile, true);
+    EXPECT_TRUE(cache.get("key", hash).isNull());
+    cache.set("key", hash, "data");
+    EXPECT_EQ("data", cache.get("key", hash));
+    cache.save();
+  }
+
+  ProjectCache cache(mProjectDir, mCacheFile, true);
+  EXPECT_EQ("data", cache.get("key", hash));
+  EXPECT_TRUE(cache.get("key", ProjectCache::calcHash("other")).isNull());
+  EXPECT_TRUE(cache.get("other", hash).isNull());
+}
+
+TEST_F(ProjectCacheTest, testUnusedEntriesAreRemoved) {
+  const QByteArray hash = ProjectCache::calcHash("input");
+  {
+    ProjectCache cache(mProjectDir, mCacheFile, true);
+    cache.set("unused", hash, "data");
+    cache.save();
+  }
+  {
+    ProjectCache cache(mProjectDir, mCacheFile, true);
+    cache.set("key", hash, "data");
+    cache.save();
+  }
+
+  ProjectCache cache(mProjectDir, mCacheFile, true);
+  EXPECT_TRUE(cache.get("unused", hash).isNull());
+  EXPECT_EQ("data", cache.get("key", hash));
+}
+
+TEST_F(ProjectCacheTest, testReadOnlyCacheIsNotWritten) {
+  ProjectCache cache(mProjectDir, mCacheFile, false);
+  cache.parse(mContent, mFile);
+  cache.save();
+  EXPECT_FALSE(cache.getFilePath().isExistingFile());
+}
+
+TEST_F(ProjectCacheTest, testDefaultFilePathIsOutsideProject) {
+  const FilePath fp = ProjectCache::getDefaultFilePath(mProjectDir);
+  EXPECT_TRUE(fp.isValid());
+  EXPECT_FALSE(fp.isLocatedInDir(mProjectDir));
+  EXPECT_NE(fp, ProjectCache::getDefaultFilePath(mFile.getParentDir()));
+}
+
+TEST_F(ProjectCacheTest, testRemoveOutdatedFiles) {
+  const FilePath dir = mCacheFile.getParentDir();
+  FileUtils::writeFile(dir.getPathTo("1.lpcache"), "data");
+  FileUtils::writeFile(dir.getPathTo("2.lpcache"), "data");
+  FileUtils::writeFile(dir.getPathTo("other.txt"), "data");
+
+  // Within limits -> nothing removed.
+  ProjectCache::removeOutdatedFiles(dir, 1, 8);
+  EXPECT_TRUE(dir.getPathTo("1.lpcache").isExistingFile());
+  EXPECT_TRUE(dir.getPathTo("2.lpcache").isExistingFile());
+
+  // Size limit exceeded -> only one cache file kept.
+  ProjectCache::removeOutdatedFiles(dir, 1, 4);
+  EXPECT_EQ(1,
+            QDir(dir.toStr()).entryList({"*.lpcache"}, QDir::Files).count());
+
+  // Size limit exceeded -> all cache files removed, other files kept.
+  ProjectCache::removeOutdatedFiles(dir, 1, 0);
+  EXPECT_FALSE(dir.getPathTo("1.lpcache").isExistingFile());
+  EXPECT_FALSE(dir.getPathTo("2.lpcache").isExistingFile());
+  EXPECT_TRUE(dir.getPathTo("other.txt").isExistingFile());
+}
+
+TEST_F(ProjectCacheTest, testCorruptCacheIsIgnored) {
+  ProjectCache cache1(mProjectDir, mCacheFile, true);
+  FileUtils::writeFile(cache1.getFilePath(), "corrupt");
+
+  ProjectCache cache2(mProjectDir, mCacheFile, true);
+  SExpression root = cache2.parse(mContent, mFile);
+  EXPECT_EQ(mContent.toStdString(), root.toByteArray().toStdString());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
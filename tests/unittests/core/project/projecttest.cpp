@@ -22,8 +22,12 @@
  ******************************************************************************/
 #include <gtest/gtest.h>
 #include <librepcb/core/fileio/transactionalfilesystem.h>
+#include <librepcb/core/project/board/board.h>
+#include <librepcb/core/project/board/boardlayerstack.h>
 #include <librepcb/core/project/project.h>
 #include <librepcb/core/project/projectmetadata.h>
+#include <librepcb/core/project/schematic/schematic.h>
+#include <librepcb/core/types/gridproperties.h>
 
 #include <QtCore>
 
@@ -136,6 +140,80 @@ TEST_F(ProjectTest, testSave) {
   project.reset(new Project(createDir(), mProjectFile.getFilename()));
 }
 
+TEST_F(ProjectTest, testSaveSkipsUnmodifiedDocuments) {
+  // create new project with a schematic and a board
+  QScopedPointer<Project> project(
+      Project::create(createDir(), mProjectFile.getFilename()));
+  Schematic* schematic = project->createSchematic(ElementName("Sch"));
+  project->addSchematic(*schematic);
+  Board* board = project->createBoard(ElementName("Brd"));
+  project->addBoard(*board);
+  EXPECT_TRUE(schematic->isModified());
+  EXPECT_TRUE(board->isModified());
+
+  // save project -> documents are no longer modified
+  project->save();
+  project->getDirectory().getFileSystem()->save();
+  EXPECT_FALSE(schematic->isModified());
+  EXPECT_FALSE(board->isModified());
+
+  // re-open project -> documents are not modified
+  project.reset();
+  project.reset(new Project(createDir(), mProjectFile.getFilename()));
+  ASSERT_EQ(1, project->getSchematics().count());
+  ASSERT_EQ(1, project->getBoards().count());
+  schematic = project->getSchematics().first();
+  board = project->getBoards().first();
+  EXPECT_FALSE(schematic->isModified());
+  EXPECT_FALSE(board->isModified());
+
+  // modify board -> only the board is modified
+  GridProperties grid = board->getGridProperties();
+  grid.setInterval(PositiveLength(grid.getInterval() * 2));
+  board->setGridProperties(grid);
+  EXPECT_FALSE(schematic->isModified());
+  EXPECT_TRUE(board->isModified());
+
+  // save project -> only the board file is written
+  project->save();
+  EXPECT_FALSE(board->isModified());
+  QStringList modifications =
+      project->getDirectory().getFileSystem()->checkForModifications();
+  EXPECT_TRUE(modifications.contains(board->getRelativePath()));
+  EXPECT_FALSE(modifications.contains(
+      schematic->getFilePath().toRelative(project->getPath())));
+}
+
+TEST_F(ProjectTest, testSaveWritesUserSettingsOfUnmodifiedBoards) {
+  // create and save new project with a board
+  QScopedPointer<Project> project(
+      Project::create(createDir(), mProjectFile.getFilename()));
+  Board* board = project->createBoard(ElementName("Brd"));
+  project->addBoard(*board);
+  project->save();
+  project->getDirectory().getFileSystem()->save();
+  ASSERT_FALSE(board->isModified());
+
+  // toggle layer visibility -> board is not modified, but must be saved
+  GraphicsLayer* layer =
+      board->getLayerStack().getLayer(GraphicsLayer::sTopPlacement);
+  ASSERT_NE(nullptr, layer);
+  const bool visible = !layer->isVisible();
+  layer->setVisible(visible);
+  EXPECT_FALSE(board->isModified());
+  project->save();
+  project->getDirectory().getFileSystem()->save();
+
+  // re-open project -> layer visibility is restored
+  project.reset();
+  project.reset(new Project(createDir(), mProjectFile.getFilename()));
+  ASSERT_EQ(1, project->getBoards().count());
+  layer = project->getBoards().first()->getLayerStack().getLayer(
+      GraphicsLayer::sTopPlacement);
+  ASSERT_NE(nullptr, layer);
+  EXPECT_EQ(visible, layer->isVisible());
+}
+
 TEST_F(ProjectTest, testIfLastModifiedDateTimeIsUpdatedOnSave) {
   // create new project
   QScopedPointer<Project> project(
@@ -24,6 +24,7 @@
 #include "sexpressionlegacymode.h"
 
 #include <gtest/gtest.h>
+#include <librepcb/core/exceptions.h>
 #include <librepcb/core/serialization/sexpression.h>
 
 #include <QtCore>
@@ -157,6 +158,12 @@ TEST(SExpressionTest, testSerializeStringWithEscaping) {
   EXPECT_EQ("\"Foo\\n \\r\\n \\\" \\\\ Bar\"\n", s.toByteArray());
 }
 
+TEST(SExpressionTest, testSerializeStringWithUnicode) {
+  const QByteArray utf8 = "\xC3\xA4\xE2\x82\xAC \xF0\x9F\x98\x80";
+  SExpression s = SExpression::createString(QString::fromUtf8(utf8) + " \"");
+  EXPECT_EQ("\"" + utf8 + " \\\"\"\n", s.toByteArray());
+}
+
 TEST(SExpressionTest, testRoundtrip) {
   // Create input with wrong indentation, this shall be fixed by toByteArray().
   QByteArray input =
@@ -354,6 +361,31 @@ TEST(SExpressionTest, testToByteArrayListWithTooManyLineBreaks) {
       s.toByteArray().toStdString());
 }
 
+TEST(SExpressionTest, testBinaryRoundTrip) {
+  QByteArray input =
+      "(test \"foo \\\"bar\\\"\" (child 1)\n"
+      " (child \"\xc3\xa4\")\n"
+      ")\n";
+  SExpression s = SExpression::parse(input, FilePath());
+  QByteArray binary;
+  QDataStream out(&binary, QIODevice::WriteOnly);
+  s.writeBinary(out);
+  QDataStream in(binary);
+  SExpression s2 = SExpression::readBinary(in, FilePath());
+  EXPECT_EQ(s.toByteArray().toStdString(), s2.toByteArray().toStdString());
+}
+
+TEST(SExpressionTest, testReadBinaryTruncated) {
+  SExpression s = SExpression::createList("test");
+  s.appendChild("child", 1);
+  QByteArray binary;
+  QDataStream out(&binary, QIODevice::WriteOnly);
+  s.writeBinary(out);
+  binary.chop(1);
+  QDataStream in(binary);
+  EXPECT_THROW(SExpression::readBinary(in, FilePath()), Exception);
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
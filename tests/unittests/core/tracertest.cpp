@@ -0,0 +1,142 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <librepcb/core/tracer.h>
+
+#include <QtCore>
+
+#include <thread>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class TracerTest : public ::testing::Test {
+protected:
+  virtual void SetUp() override {
+    mWasEnabled = Tracer::instance().isEnabled();
+    Tracer::instance().setEnabled(true);
+    Tracer::instance().clear();
+  }
+
+  virtual void TearDown() override {
+    Tracer::instance().clear();
+    Tracer::instance().setEnabled(mWasEnabled);
+  }
+
+  bool mWasEnabled;
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(TracerTest, testZone) {
+  { const TraceZone traceZone("test"); }
+  const QVector<Tracer::Event> events = Tracer::instance().getEvents();
+  ASSERT_EQ(1, events.count());
+  EXPECT_STREQ("test", events.first().name);
+  EXPECT_EQ('X', events.first().phase);
+  EXPECT_GE(events.first().timestampNs, 0);
+  EXPECT_GE(events.first().durationNs, 0);
+}
+
+TEST_F(TracerTest, testNestedZones) {
+  {
+    const TraceZone outer("outer");
+    { const TraceZone inner("inner"); }
+  }
+  const QVector<Tracer::Event> events = Tracer::instance().getEvents();
+  ASSERT_EQ(2, events.count());
+  EXPECT_STREQ("inner", events.at(0).name);
+  EXPECT_STREQ("outer", events.at(1).name);
+  EXPECT_LE(events.at(1).timestampNs, events.at(0).timestampNs);
+  EXPECT_GE(events.at(1).durationNs, events.at(0).durationNs);
+  EXPECT_EQ(events.at(0).threadId, events.at(1).threadId);
+}
+
+TEST_F(TracerTest, testCounter) {
+  Tracer::counter("count", 42);
+  const QVector<Tracer::Event> events = Tracer::instance().getEvents();
+  ASSERT_EQ(1, events.count());
+  EXPECT_STREQ("count", events.first().name);
+  EXPECT_EQ('C', events.first().phase);
+  EXPECT_EQ(42, events.first().value);
+}
+
+TEST_F(TracerTest, testDisabled) {
+  Tracer::instance().setEnabled(false);
+  { const TraceZone traceZone("test"); }
+  Tracer::counter("count", 42);
+  EXPECT_EQ(0, Tracer::instance().getEvents().count());
+}
+
+TEST_F(TracerTest, testZonesFromMultipleThreads) {
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([]() { const TraceZone traceZone("task"); });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  const QVector<Tracer::Event> events = Tracer::instance().getEvents();
+  QSet<quint64> threadIds;
+  foreach (const Tracer::Event& event, events) {
+    threadIds.insert(event.threadId);
+  }
+  EXPECT_EQ(4, events.count());
+  EXPECT_EQ(4, threadIds.count());
+}
+
+TEST_F(TracerTest, testChromeTraceJson) {
+  { const TraceZone traceZone("zone"); }
+  Tracer::counter("count", 3);
+  const QJsonDocument doc =
+      QJsonDocument::fromJson(Tracer::instance().toChromeTraceJson());
+  ASSERT_TRUE(doc.isObject());
+  const QJsonArray events = doc.object().value("traceEvents").toArray();
+  ASSERT_EQ(2, events.count());
+  const QJsonObject zone = events.at(0).toObject();
+  EXPECT_EQ("zone", zone.value("name").toString().toStdString());
+  EXPECT_EQ("X", zone.value("ph").toString().toStdString());
+  EXPECT_TRUE(zone.contains("ts"));
+  EXPECT_TRUE(zone.contains("dur"));
+  const QJsonObject counter = events.at(1).toObject();
+  EXPECT_EQ("count", counter.value("name").toString().toStdString());
+  EXPECT_EQ("C", counter.value("ph").toString().toStdString());
+  EXPECT_EQ(3, counter.value("args").toObject().value("value").toInt());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
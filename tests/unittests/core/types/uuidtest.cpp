@@ -180,6 +180,39 @@ TEST_P(UuidTest, testTryFromString) {
   }
 }
 
+TEST_P(UuidTest, testFromUtf8) {
+  const UuidTestData& data = GetParam();
+  if (data.valid) {
+    EXPECT_EQ(data.uuid, Uuid::fromUtf8(data.uuid.toUtf8()).toStr());
+    EXPECT_EQ(Uuid::fromString(data.uuid), Uuid::fromUtf8(data.uuid.toUtf8()));
+  } else {
+    EXPECT_THROW(Uuid::fromUtf8(data.uuid.toUtf8()), Exception);
+  }
+}
+
+TEST_P(UuidTest, testTryFromUtf8) {
+  const UuidTestData& data = GetParam();
+  tl::optional<Uuid> uuid = Uuid::tryFromUtf8(data.uuid.toUtf8());
+  if (data.valid) {
+    EXPECT_TRUE(uuid);
+    EXPECT_EQ(data.uuid, uuid->toStr());
+  } else {
+    EXPECT_FALSE(uuid);
+  }
+}
+
+TEST_P(UuidTest, testQHash) {
+  const UuidTestData& data = GetParam();
+  if (data.valid) {
+    Uuid uuid1 = Uuid::fromString(data.uuid);
+    Uuid uuid2 = Uuid::fromUtf8(data.uuid.toUtf8());
+    EXPECT_EQ(qHash(uuid1, 0), qHash(uuid2, 0));
+    EXPECT_EQ(qHash(uuid1, 42), qHash(uuid2, 42));
+    QSet<Uuid> set = {uuid1};
+    EXPECT_TRUE(set.contains(uuid2));
+  }
+}
+
 TEST_P(UuidTest, testSerialize) {
   const UuidTestData& data = GetParam();
   if (data.valid) {
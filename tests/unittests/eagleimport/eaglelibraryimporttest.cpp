@@ -70,6 +70,39 @@ TEST_F(EagleLibraryImportTest, testImport) {
   EXPECT_EQ(0, importErrors.count());
 }
 
+TEST_F(EagleLibraryImportTest, testImportSequentially) {
+  FilePath src(TEST_DATA_DIR "/unittests/eagleimport/resistor.lbr");
+  FilePath dst = FilePath::getRandomTempPath();
+
+  EagleLibraryImport import(dst);
+  import.setMaxThreadCount(1);
+
+  // Connect signals by hand because QSignalSpy is not threadsafe!
+  int signalFinished = 0;
+  QStringList importErrors;
+  QObject::connect(&import, &EagleLibraryImport::finished,
+                   [&signalFinished, &importErrors](const QStringList& e) {
+                     ++signalFinished;
+                     importErrors = e;
+                   });
+
+  import.open(src);
+  import.setDeviceChecked(import.getDevices().first().displayName, true);
+  EXPECT_EQ(4, import.getCheckedElementsCount());
+
+  import.start();
+  EXPECT_TRUE(import.wait(10000));
+  EXPECT_EQ(1, signalFinished);
+  EXPECT_EQ(0, importErrors.count());
+  foreach (const QString& dir, QStringList({"sym", "pkg", "cmp", "dev"})) {
+    EXPECT_EQ(1, QDir(dst.getPathTo(dir).toStr())
+                     .entryList(QDir::Dirs | QDir::NoDotAndDotDot)
+                     .count())
+        << dir.toStdString();
+  }
+  QDir(dst.toStr()).removeRecursively();
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -0,0 +1,153 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <librepcb/core/fileio/fileutils.h>
+#include <librepcb/core/fileio/transactionaldirectory.h>
+#include <librepcb/core/fileio/transactionalfilesystem.h>
+#include <librepcb/core/library/sym/symbol.h>
+#include <librepcb/core/sqlitedatabase.h>
+#include <librepcb/core/utils/toolbox.h>
+#include <librepcb/core/workspace/workspacelibrarydb.h>
+#include <librepcb/core/workspace/workspacelibrarydbwriter.h>
+#include <librepcb/editor/library/libraryelementcache.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace editor {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class LibraryElementCacheTest : public ::testing::Test {
+protected:
+  FilePath mWsDir;
+  std::unique_ptr<WorkspaceLibraryDb> mWsDb;
+  std::unique_ptr<SQLiteDatabase> mDb;
+  std::unique_ptr<WorkspaceLibraryDbWriter> mWriter;
+  std::shared_ptr<TransactionalFileSystem> mFs;
+  QList<Uuid> mSymbols;
+
+  LibraryElementCacheTest() : mWsDir(FilePath::getRandomTempPath()) {
+    FileUtils::makePath(mWsDir);
+    mWsDb.reset(new WorkspaceLibraryDb(mWsDir));
+    mDb.reset(new SQLiteDatabase(mWsDb->getFilePath()));
+    mWriter.reset(new WorkspaceLibraryDbWriter(mWsDir, *mDb));
+    mFs.reset(new TransactionalFileSystem(mWsDir, true));
+
+    // Create some symbols of the same size.
+    for (int i = 0; i < 3; ++i) {
+      const Uuid uuid = Uuid::createRandom();
+      const Version version = Version::fromString("0.1");
+      TransactionalDirectory dir(mFs, uuid.toStr());
+      Symbol sym(uuid, version, "", ElementName(QString("sym %1").arg(i)), "",
+                 "");
+      sym.saveTo(dir);
+      mWriter->addElement<Symbol>(0, mWsDir.getPathTo(uuid.toStr()), uuid,
+                                  version, false);
+      mSymbols.append(uuid);
+    }
+    mFs->save();
+  }
+
+  virtual ~LibraryElementCacheTest() {
+    QDir(mWsDir.toStr()).removeRecursively();
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(LibraryElementCacheTest, testHitsAndMisses) {
+  LibraryElementCache cache(*mWsDb);
+  std::shared_ptr<const Symbol> sym = cache.getSymbol(mSymbols.at(0));
+  ASSERT_TRUE(sym);
+  EXPECT_EQ(mSymbols.at(0), sym->getUuid());
+  EXPECT_EQ(sym, cache.getSymbol(mSymbols.at(0)));
+  EXPECT_FALSE(cache.getSymbol(Uuid::createRandom()));
+
+  LibraryElementCache::Statistics stats = cache.getStatistics();
+  EXPECT_EQ(1, stats.hits);
+  EXPECT_EQ(2, stats.misses);
+  EXPECT_EQ(0, stats.prefetched);
+  EXPECT_EQ(0, stats.evictions);
+  EXPECT_EQ(1, stats.elementCount);
+  EXPECT_GT(stats.totalCost, 0);
+}
+
+TEST_F(LibraryElementCacheTest, testLeastRecentlyUsedEviction) {
+  LibraryElementCache cache(*mWsDb);
+  ASSERT_TRUE(cache.getSymbol(mSymbols.at(0)));
+  const int cost = cache.getStatistics().totalCost;
+
+  // Limit the cache size to two symbols.
+  cache.setMaxCost(cost * 2 + cost / 2);
+  ASSERT_TRUE(cache.getSymbol(mSymbols.at(1)));
+  ASSERT_TRUE(cache.getSymbol(mSymbols.at(0)));  // Now the most recently used.
+  ASSERT_TRUE(cache.getSymbol(mSymbols.at(2)));  // Evicts symbol 1.
+  LibraryElementCache::Statistics stats = cache.getStatistics();
+  EXPECT_EQ(1, stats.evictions);
+  EXPECT_EQ(2, stats.elementCount);
+  EXPECT_LE(stats.totalCost, stats.maxCost);
+
+  cache.resetStatistics();
+  EXPECT_TRUE(cache.getSymbol(mSymbols.at(0)));
+  EXPECT_TRUE(cache.getSymbol(mSymbols.at(2)));
+  EXPECT_TRUE(cache.getSymbol(mSymbols.at(1)));
+  stats = cache.getStatistics();
+  EXPECT_EQ(2, stats.hits);
+  EXPECT_EQ(1, stats.misses);
+}
+
+TEST_F(LibraryElementCacheTest, testPrefetch) {
+  LibraryElementCache cache(*mWsDb);
+  cache.prefetchSymbols(Toolbox::toSet(mSymbols));
+  cache.waitForPrefetchFinished();
+  LibraryElementCache::Statistics stats = cache.getStatistics();
+  EXPECT_EQ(3, stats.prefetched);
+  EXPECT_EQ(3, stats.elementCount);
+
+  foreach (const Uuid& uuid, mSymbols) {
+    std::shared_ptr<const Symbol> sym = cache.getSymbol(uuid);
+    ASSERT_TRUE(sym);
+    EXPECT_EQ(QThread::currentThread(), sym->thread());
+  }
+  stats = cache.getStatistics();
+  EXPECT_EQ(3, stats.hits);
+  EXPECT_EQ(0, stats.misses);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace editor
+}  // namespace librepcb
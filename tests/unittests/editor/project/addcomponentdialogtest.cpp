@@ -294,9 +294,12 @@ TEST_F(AddComponentDialogTest, testSearch) {
   QTreeWidget& cmpView =
       TestHelpers::getChild<QTreeWidget>(dialog, "treeComponents");
 
+  // Note: The search runs asynchronously, thus wait for the results.
+
   // Search "cmp" -> 2 results
   edtSearch.setText("cmp");
-  EXPECT_EQ(2, cmpView.model()->rowCount());
+  EXPECT_TRUE(
+      TestHelpers::waitFor([&]() { return cmpView.model()->rowCount() == 2; }));
   EXPECT_EQ("cmp 1",
             cmpView.model()->index(0, 0).data().toString().toStdString());
   EXPECT_EQ("cmp 2",
@@ -304,15 +307,49 @@ TEST_F(AddComponentDialogTest, testSearch) {
 
   // Search "foo" -> 0 results
   edtSearch.setText("foo");
-  EXPECT_EQ(0, cmpView.model()->rowCount());
+  EXPECT_TRUE(
+      TestHelpers::waitFor([&]() { return cmpView.model()->rowCount() == 0; }));
 
   // Search "key" -> 1 results
   edtSearch.setText("key");
-  EXPECT_EQ(1, cmpView.model()->rowCount());
+  EXPECT_TRUE(
+      TestHelpers::waitFor([&]() { return cmpView.model()->rowCount() == 1; }));
   EXPECT_EQ("cmp 1",
             cmpView.model()->index(0, 0).data().toString().toStdString());
 }
 
+TEST_F(AddComponentDialogTest, testSearchSupersededByNewInput) {
+  int cmpId = mWriter->addElement<Component>(0, toAbs("cmp1"), uuid(1),
+                                             version("0.1"), false);
+  mWriter->addTranslation<Component>(cmpId, "", ElementName("cmp 1"),
+                                     tl::nullopt, tl::nullopt);
+  cmpId = mWriter->addElement<Component>(0, toAbs("cmp2"), uuid(2),
+                                         version("0.1"), false);
+  mWriter->addTranslation<Component>(cmpId, "", ElementName("foo 2"),
+                                     tl::nullopt, tl::nullopt);
+
+  // Create dialog
+  AddComponentDialog dialog(*mWsDb, {}, {});
+  QLineEdit& edtSearch = TestHelpers::getChild<QLineEdit>(dialog, "edtSearch");
+  QTreeWidget& cmpView =
+      TestHelpers::getChild<QTreeWidget>(dialog, "treeComponents");
+
+  // Type quickly -> only the result of the last input is shown
+  edtSearch.setText("cm");
+  edtSearch.setText("cmp");
+  edtSearch.setText("foo");
+  EXPECT_TRUE(
+      TestHelpers::waitFor([&]() { return cmpView.model()->rowCount() == 1; }));
+  EXPECT_EQ("foo 2",
+            cmpView.model()->index(0, 0).data().toString().toStdString());
+
+  // Make sure no outdated result arrives later
+  QTest::qWait(300);
+  EXPECT_EQ(1, cmpView.model()->rowCount());
+  EXPECT_EQ("foo 2",
+            cmpView.model()->index(0, 0).data().toString().toStdString());
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -46,6 +46,9 @@ int main(int argc, char* argv[]) {
   Application::setOrganizationDomain("librepcb.org");
   Application::setApplicationName("LibrePCB-UnitTests");
 
+  // don't write any files (e.g. project caches) into the user's directories
+  QStandardPaths::setTestModeEnabled(true);
+
   // disable the whole debug output (we want only the output from gtest)
   Debug::instance()->setDebugLevelLogFile(Debug::DebugLevel_t::Nothing);
   Debug::instance()->setDebugLevelStderr(Debug::DebugLevel_t::Nothing);